@@ -6074,6 +6074,11 @@ autocomplete_t autocompletelist[] = {
     { "if infiniteheight on ",                       DOOM1AND2 },
     { "if infiniteheight on then ",                  DOOM1AND2 },
     { "if iwadfolder ",                              DOOM1AND2 },
+    { "if lazymonsters ",                            DOOM1AND2 },
+    { "if lazymonsters off ",                        DOOM1AND2 },
+    { "if lazymonsters off then ",                   DOOM1AND2 },
+    { "if lazymonsters on ",                         DOOM1AND2 },
+    { "if lazymonsters on then ",                    DOOM1AND2 },
     { "if m_acceleration ",                          DOOM1AND2 },
     { "if m_acceleration off ",                      DOOM1AND2 },
     { "if m_acceleration off then ",                 DOOM1AND2 },
@@ -6258,6 +6263,11 @@ autocomplete_t autocompletelist[] = {
     { "if r_liquid_swirl on ",                       DOOM1AND2 },
     { "if r_liquid_swirl on then ",                  DOOM1AND2 },
     { "if r_lowpixelsize ",                          DOOM1AND2 },
+    { "if r_mipmaps ",                               DOOM1AND2 },
+    { "if r_mipmaps off ",                           DOOM1AND2 },
+    { "if r_mipmaps off then ",                      DOOM1AND2 },
+    { "if r_mipmaps on ",                            DOOM1AND2 },
+    { "if r_mipmaps on then ",                       DOOM1AND2 },
     { "if r_mirroredweapons ",                       DOOM1AND2 },
     { "if r_mirroredweapons off ",                   DOOM1AND2 },
     { "if r_mirroredweapons off then ",              DOOM1AND2 },
@@ -6552,8 +6562,12 @@ autocomplete_t autocompletelist[] = {
     { "kill spidermasterminds",                      DOOM1AND2 },
     { "kill wolfensteinss",                          DOOM2ONLY },
     { "kill zombiemen",                              DOOM1AND2 },
+    { "lazymonsters ",                               DOOM1AND2 },
+    { "lazymonsters off",                            DOOM1AND2 },
+    { "lazymonsters on",                             DOOM1AND2 },
     { "+left",                                       DOOM1AND2 },
     { "load ",                                       DOOM1AND2 },
+    { "loaderstats",                                 DOOM1AND2 },
     { "m_acceleration ",                             DOOM1AND2 },
     { "m_acceleration off",                          DOOM1AND2 },
     { "m_acceleration on",                           DOOM1AND2 },
@@ -6655,6 +6669,7 @@ autocomplete_t autocompletelist[] = {
     { "map random",                                  DOOM1AND2 },
     { "maplist",                                     DOOM1AND2 },
     { "mapstats",                                    DOOM1AND2 },
+    { "memreport",                                   DOOM1AND2 },
     { "+mark",                                       DOOM1AND2 },
     { "+maxzoom",                                    DOOM1AND2 },
     { "+menu",                                       DOOM1AND2 },
@@ -6957,6 +6972,9 @@ autocomplete_t autocompletelist[] = {
     { "r_liquid_swirl off",                          DOOM1AND2 },
     { "r_liquid_swirl on",                           DOOM1AND2 },
     { "r_lowpixelsize ",                             DOOM1AND2 },
+    { "r_mipmaps ",                                  DOOM1AND2 },
+    { "r_mipmaps off",                               DOOM1AND2 },
+    { "r_mipmaps on",                                DOOM1AND2 },
     { "r_mirroredweapons ",                          DOOM1AND2 },
     { "r_mirroredweapons off",                       DOOM1AND2 },
     { "r_mirroredweapons on",                        DOOM1AND2 },
@@ -7057,6 +7075,7 @@ autocomplete_t autocompletelist[] = {
     { "reset infighting",                            DOOM1AND2 },
     { "reset infiniteheight",                        DOOM1AND2 },
     { "reset iwadfolder",                            DOOM1AND2 },
+    { "reset lazymonsters",                          DOOM1AND2 },
     { "reset m_acceleration",                        DOOM1AND2 },
     { "reset m_doubleclick_use",                     DOOM1AND2 },
     { "reset m_invertyaxis",                         DOOM1AND2 },
@@ -7096,6 +7115,7 @@ autocomplete_t autocompletelist[] = {
     { "reset r_liquid_lowerview",                    DOOM1AND2 },
     { "reset r_liquid_swirl",                        DOOM1AND2 },
     { "reset r_lowpixelsize",                        DOOM1AND2 },
+    { "reset r_mipmaps",                             DOOM1AND2 },
     { "reset r_mirroredweapons",                     DOOM1AND2 },
     { "reset r_playersprites",                       DOOM1AND2 },
     { "reset r_rockettrails",                        DOOM1AND2 },
@@ -291,10 +291,12 @@ static void if_cmd_func2(char *cmd, char *parms);
 static dboolean kill_cmd_func1(char *cmd, char *parms);
 void kill_cmd_func2(char *cmd, char *parms);
 static void load_cmd_func2(char *cmd, char *parms);
+static void loaderstats_cmd_func2(char *cmd, char *parms);
 static dboolean map_cmd_func1(char *cmd, char *parms);
 static void map_cmd_func2(char *cmd, char *parms);
 static void maplist_cmd_func2(char *cmd, char *parms);
 static void mapstats_cmd_func2(char *cmd, char *parms);
+static void memreport_cmd_func2(char *cmd, char *parms);
 static void newgame_cmd_func2(char *cmd, char *parms);
 static void noclip_cmd_func2(char *cmd, char *parms);
 static void nomonsters_cmd_func2(char *cmd, char *parms);
@@ -595,8 +597,12 @@ consolecmd_t consolecmds[] =
         "The folder where an IWAD was last opened."),
     CMD(kill, explode, kill_cmd_func1, kill_cmd_func2, true, KILLCMDFORMAT,
         "Kills the <b>player</b>, <b>all</b> monsters, a type of <i>monster</i>,\nor explodes all <b>barrels</b> or <b>missiles</b>."),
+    CVAR_BOOL(lazymonsters, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
+        "Toggles monsters far away from the player that\nhaven't seen them yet thinking less often."),
     CMD(load, "", null_func1, load_cmd_func2, true, LOADCMDFORMAT,
         "Loads a game from a file."),
+    CMD(loaderstats, "", null_func1, loaderstats_cmd_func2, false, "",
+        "Shows how many lumps have been read ahead of time,\nand how many were read when needed."),
     CVAR_BOOL(m_acceleration, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles the acceleration of mouse movement."),
     CVAR_BOOL(m_doubleclick_use, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
@@ -613,6 +619,8 @@ consolecmd_t consolecmds[] =
         "Lists all maps in the currently loaded WADs."),
     CMD(mapstats, "", game_func1, mapstats_cmd_func2, false, "",
         "Shows statistics about the current map."),
+    CMD(memreport, "", null_func1, memreport_cmd_func2, false, "",
+        "Shows how much memory is being used, and where."),
     CVAR_BOOL(messages, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles player messages."),
     CVAR_BOOL(mouselook, "", bool_cvars_func1, mouselook_cvar_func2, BOOLVALUEALIAS,
@@ -702,6 +710,8 @@ consolecmd_t consolecmds[] =
         "Toggles the swirl effect of liquid sectors."),
     CVAR_OTHER(r_lowpixelsize, "", null_func1, r_lowpixelsize_cvar_func2,
         "The size of pixels when the graphic detail is low\n(<i>width</i><b>\xD7</b><i>height</i>)."),
+    CVAR_BOOL(r_mipmaps, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
+        "Toggles using lower resolution versions of wall\ntextures that are far away."),
     CVAR_BOOL(r_mirroredweapons, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles randomly mirroring the weapons dropped\nby monsters."),
     CVAR_BOOL(r_playersprites, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
@@ -2653,6 +2663,30 @@ static void load_cmd_func2(char *cmd, char *parms)
         (M_StringEndsWith(parms, ".save") ? "" : ".save"), NULL));
 }
 
+//
+// loaderstats CCMD
+//
+static void loaderstats_cmd_func2(char *cmd, char *parms)
+{
+    const int   tabs[8] = { 200, 0, 0, 0, 0, 0, 0, 0 };
+    const char  *prioritynames[NUMLOADERPRIORITIES] = { "next map", "intermission" };
+    const int   requests = loaderstats.hits + loaderstats.misses;
+
+    C_Header(tabs, LOADERSTATSTITLE);
+
+    for (int i = 0; i < NUMLOADERPRIORITIES; i++)
+        C_TabbedOutput(tabs, "Lumps read ahead for %s\t<b>%s</b> of <b>%s</b> queued (<b>%s</b> waiting)",
+            prioritynames[i], commify(loaderstats.loaded[i]), commify(loaderstats.queued[i]),
+            commify(W_QueuedLumps((loaderpriority_t)i)));
+
+    C_TabbedOutput(tabs, "Lumps already cached when reached\t<b>%s</b>", commify(loaderstats.alreadycached));
+    C_TabbedOutput(tabs, "Read ahead\t<b>%s KB</b>", commify((int64_t)((loaderstats.loadedbytes + 1023) / 1024)));
+    C_TabbedOutput(tabs, "Lumps read ahead before they were needed\t<b>%s</b> (<b>%i%%</b>)",
+        commify(loaderstats.hits), (requests ? (int)((int64_t)loaderstats.hits * 100 / requests) : 0));
+    C_TabbedOutput(tabs, "Lumps read when needed\t<b>%s</b>", commify(loaderstats.misses));
+    C_TabbedOutput(tabs, "Read when needed\t<b>%s KB</b>", commify((int64_t)((loaderstats.missedbytes + 1023) / 1024)));
+}
+
 //
 // map CCMD
 //
@@ -2820,14 +2854,14 @@ static dboolean map_cmd_func1(char *cmd, char *parms)
             if (gamemode == commercial)
             {
                 mapcmdepisode = gameepisode;
-                mapcmdmap = M_RandomIntNoRepeat(1, (gamemission == pack_nerve ? 8 : 30), gamemap);
+                mapcmdmap = M_CosmeticRandomIntNoRepeat(1, (gamemission == pack_nerve ? 8 : 30), gamemap);
                 M_snprintf(mapcmdlump, sizeof(mapcmdlump), "MAP%02i", mapcmdmap);
                 result = true;
             }
             else
             {
-                mapcmdepisode = (gamemode == shareware || chex ? 1 : M_RandomIntNoRepeat(1, (gamemode == retail ? 4 : 3), gameepisode));
-                mapcmdmap = M_RandomIntNoRepeat(1, 8, gamemap);
+                mapcmdepisode = (gamemode == shareware || chex ? 1 : M_CosmeticRandomIntNoRepeat(1, (gamemode == retail ? 4 : 3), gameepisode));
+                mapcmdmap = M_CosmeticRandomIntNoRepeat(1, 8, gamemap);
                 M_snprintf(mapcmdlump, sizeof(mapcmdlump), "E%iM%i", mapcmdepisode, mapcmdmap);
                 result = true;
             }
@@ -3378,6 +3412,101 @@ static void mapstats_cmd_func2(char *cmd, char *parms)
     }
 }
 
+//
+// memreport CCMD
+//
+static const struct
+{
+    const char  *prefix;
+    const char  *name;
+} subsystems[] =
+{
+    { "am_", "Automap"       },
+    { "c_",  "Console"       },
+    { "d_",  "Startup"       },
+    { "f_",  "Finale"        },
+    { "g_",  "Game"          },
+    { "hu_", "HUD"           },
+    { "i_",  "System"        },
+    { "m_",  "Menu"          },
+    { "p_",  "Gameplay"      },
+    { "r_",  "Renderer"      },
+    { "s_",  "Sound"         },
+    { "st_", "Status bar"    },
+    { "v_",  "Video"         },
+    { "w_",  "WADs"          },
+    { "wi_", "Intermission"  },
+    { "z_",  "Zone"          }
+};
+
+#define MAXMEMREPORTSITES   10
+
+static char *memsize(size_t bytes)
+{
+    return M_StringJoin(commify((int64_t)((bytes + 1023) / 1024)), " KB", NULL);
+}
+
+static void memreport_cmd_func2(char *cmd, char *parms)
+{
+    const int       tabs[8] = { 200, 0, 0, 0, 0, 0, 0, 0 };
+    const char      *tagnames[PU_MAX] = { "", "Static", "Level", "Level specials", "Cache" };
+    size_t          subsystembytes[arrlen(subsystems) + 1] = { 0 };
+    unsigned int    order[arrlen(subsystems) + 1];
+    zonesite_t      *sites;
+    const int       numsites = Z_GetSites(&sites);
+
+    C_Header(tabs, MEMREPORTTITLE);
+
+    C_TabbedOutput(tabs, "Currently used\t<b>%s</b>", memsize(zonestats.current));
+    C_TabbedOutput(tabs, "Peak\t<b>%s</b>", memsize(zonestats.peak));
+
+    if (gamestate == GS_LEVEL)
+        C_TabbedOutput(tabs, "Peak in current map\t<b>%s</b>", memsize(zonestats.levelpeak));
+
+    if (zonestats.budget)
+    {
+        C_TabbedOutput(tabs, "Budget\t<b>%s</b> (cache purged <b>%s</b> time%s)",
+            memsize(zonestats.budget), commify(zonestats.purges), (zonestats.purges == 1 ? "" : "s"));
+        C_TabbedOutput(tabs, "Purged to stay within budget\t<b>%s</b>", memsize(zonestats.purged));
+    }
+
+    for (int i = PU_STATIC; i < PU_MAX; i++)
+        C_TabbedOutput(tabs, "%s tag\t<b>%s</b>", tagnames[i], memsize(zonestats.tagbytes[i]));
+
+    C_TabbedOutput(tabs, "Resizable arrays\t<b>%s</b>", memsize(zonestats.arraybytes));
+
+    // total up each subsystem, and put them in order of size
+    for (int i = 0; i < numsites; i++)
+    {
+        char            *file = leafname((char *)sites[i].file);
+        unsigned int    j = 0;
+
+        while (j < arrlen(subsystems) && !M_StringStartsWith(file, subsystems[j].prefix))
+            j++;
+
+        subsystembytes[j] += sites[i].bytes;
+    }
+
+    for (unsigned int i = 0; i <= arrlen(subsystems); i++)
+    {
+        unsigned int    j = i;
+
+        for (; j > 0 && subsystembytes[order[j - 1]] < subsystembytes[i]; j--)
+            order[j] = order[j - 1];
+
+        order[j] = i;
+    }
+
+    for (unsigned int i = 0; i <= arrlen(subsystems); i++)
+        if (subsystembytes[order[i]])
+            C_TabbedOutput(tabs, "%s\t<b>%s</b>", (order[i] < arrlen(subsystems) ? subsystems[order[i]].name : "Other"),
+                memsize(subsystembytes[order[i]]));
+
+    for (int i = 0; i < MIN(numsites, MAXMEMREPORTSITES); i++)
+        C_TabbedOutput(tabs, "%s:%i\t<b>%s</b> in %s %s%s", leafname((char *)sites[i].file), sites[i].line,
+            memsize(sites[i].bytes), commify(sites[i].count), (sites[i].tag < 0 ? "array" : "block"), (sites[i].count == 1 ? "" : "s"));
+}
+
 //
 // newgame CCMD
 //
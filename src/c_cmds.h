@@ -46,8 +46,10 @@
 #define BINDLISTTITLE       "CONTROL\t+ACTION"
 #define CMDLISTTITLE        "CCMD\tDESCRIPTION"
 #define CVARLISTTITLE       "CVAR\tDEFAULT\tDESCRIPTION"
+#define LOADERSTATSTITLE    "STAT\tVALUE"
 #define MAPLISTTITLE        "MAP\tNAME\tWAD"
 #define MAPSTATSTITLE       "STAT\tTOTAL"
+#define MEMREPORTTITLE      "MEMORY\tSIZE"
 #define PLAYERSTATSTITLE    "STAT\tCURRENT MAP\tTOTAL"
 #define THINGLISTTITLE      "THING\tPOSITION"
 
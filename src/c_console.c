@@ -517,7 +517,7 @@ void C_Init(void)
         char    buffer[9];
 
         M_snprintf(buffer, sizeof(buffer), "DRFON%03d", j++);
-        consolefont[i] = W_CacheLumpName(buffer);
+        consolefont[i] = W_LockLumpName(buffer);
     }
 
     consolebackcolor = nearestcolors[con_backcolor] << 8;
@@ -547,27 +547,27 @@ void C_Init(void)
     consolecolors[playermessagestring] = consoleplayermessagecolor;
     consolecolors[obituarystring] = consoleplayermessagecolor;
 
-    brand = W_CacheLumpName("DRBRAND");
-    dot = W_CacheLumpName("DRFON046");
-    trademark = W_CacheLumpName("DRFON153");
-    copyright = W_CacheLumpName("DRFON169");
-    regomark = W_CacheLumpName("DRFON174");
-    degree = W_CacheLumpName("DRFON176");
-    multiply = W_CacheLumpName("DRFON215");
-    unknownchar = W_CacheLumpName("DRFON000");
-
-    caret = W_CacheLumpName("DRCARET");
-    divider = W_CacheLumpName("DRDIVIDE");
-    warning = W_CacheLumpName("DRFONWRN");
-    altunderscores = W_CacheLumpName("DRFONUND");
-
-    bindlist = W_CacheLumpName("DRBNDLST");
-    cmdlist = W_CacheLumpName("DRCMDLST");
-    cvarlist = W_CacheLumpName("DRCVRLST");
-    maplist = W_CacheLumpName("DRMAPLST");
-    mapstats = W_CacheLumpName("DRMAPST");
-    playerstats = W_CacheLumpName("DRPLYRST");
-    thinglist = W_CacheLumpName("DRTHNLST");
+    brand = W_LockLumpName("DRBRAND");
+    dot = W_LockLumpName("DRFON046");
+    trademark = W_LockLumpName("DRFON153");
+    copyright = W_LockLumpName("DRFON169");
+    regomark = W_LockLumpName("DRFON174");
+    degree = W_LockLumpName("DRFON176");
+    multiply = W_LockLumpName("DRFON215");
+    unknownchar = W_LockLumpName("DRFON000");
+
+    caret = W_LockLumpName("DRCARET");
+    divider = W_LockLumpName("DRDIVIDE");
+    warning = W_LockLumpName("DRFONWRN");
+    altunderscores = W_LockLumpName("DRFONUND");
+
+    bindlist = W_LockLumpName("DRBNDLST");
+    cmdlist = W_LockLumpName("DRCMDLST");
+    cvarlist = W_LockLumpName("DRCVRLST");
+    maplist = W_LockLumpName("DRMAPLST");
+    mapstats = W_LockLumpName("DRMAPST");
+    playerstats = W_LockLumpName("DRPLYRST");
+    thinglist = W_LockLumpName("DRTHNLST");
 
     brandwidth = SHORT(brand->width);
     brandheight = SHORT(brand->height);
@@ -65,6 +65,7 @@
 #include "m_config.h"
 #include "m_menu.h"
 #include "m_misc.h"
+#include "m_random.h"
 #include "p_local.h"
 #include "p_saveg.h"
 #include "p_setup.h"
@@ -389,6 +390,7 @@ static void D_DoomLoop(void)
 
     time(&rawtime);
     gamestarttime = localtime(&rawtime);
+    M_CosmeticSeed((unsigned int)rawtime);
 
     viewplayer = &player;
     viewplayer->damagecount = 0;
@@ -399,6 +401,8 @@ static void D_DoomLoop(void)
 
         S_UpdateSounds();   // move positional sounds
 
+        Z_CheckBudget();    // purge cached lumps if over the memory budget
+
         // Update display, next frame, with current state.
         D_Display();
     }
@@ -1676,6 +1680,18 @@ static void D_DoomMainSetup(void)
     if ((devparm = M_CheckParm("-devparm")))
         C_Output("A <b>-devparm</b> parameter was found on the command-line. %s", s_D_DEVSTR);
 
+    if ((p = M_CheckParmWithArgs("-membudget", 1, 1)))
+    {
+        int budget = atoi(myargv[p + 1]);
+
+        if (budget > 0)
+        {
+            Z_SetBudget((size_t)budget << 20);
+            C_Output("A <b>-membudget</b> parameter was found on the command-line. Cached data will be purged whenever "
+                "more than %s MB of memory is being used.", commify(budget));
+        }
+    }
+
     // turbo option
     if ((p = M_CheckParm("-turbo")))
     {
@@ -2044,26 +2060,26 @@ static void D_DoomMainSetup(void)
         G_LoadGame(P_SaveGameFile(startloadgame));
     }
 
-    splashlump = W_CacheLumpName("SPLASH");
-    splashpal = W_CacheLumpName("SPLSHPAL");
+    splashlump = W_LockLumpName("SPLASH");
+    splashpal = W_LockLumpName("SPLSHPAL");
 
     for (int i = 0; i < 18; i++)
     {
         char    buffer[9];
 
         M_snprintf(buffer, sizeof(buffer), "DRLOGO%.2d", i + 1);
-        logolump[i] = W_CacheLumpName(buffer);
+        logolump[i] = W_LockLumpName(buffer);
     }
 
     if (autosigil)
     {
-        titlelump = W_CacheLastLumpName((TITLEPIC ? "TITLEPIC" : (DMENUPIC ? "DMENUPIC" : "INTERPIC")));
-        creditlump = W_CacheLastLumpName("CREDIT");
+        titlelump = W_LockLastLumpName((TITLEPIC ? "TITLEPIC" : (DMENUPIC ? "DMENUPIC" : "INTERPIC")));
+        creditlump = W_LockLastLumpName("CREDIT");
     }
     else
     {
-        titlelump = W_CacheLumpName((TITLEPIC ? "TITLEPIC" : (DMENUPIC ? "DMENUPIC" : "INTERPIC")));
-        creditlump = W_CacheLumpName("CREDIT");
+        titlelump = W_LockLumpName((TITLEPIC ? "TITLEPIC" : (DMENUPIC ? "DMENUPIC" : "INTERPIC")));
+        creditlump = W_LockLumpName("CREDIT");
     }
 
     if (gameaction != ga_loadgame)
@@ -441,13 +441,13 @@ dboolean        firstevent;
 static int F_RandomizeSound(int sound)
 {
     if (sound >= sfx_posit1 && sound <= sfx_posit3)
-        return sfx_posit1 + M_Random() % 3;
+        return sfx_posit1 + M_CosmeticRandom() % 3;
     else if (sound == sfx_bgsit1 || sound == sfx_bgsit2)
-        return sfx_bgsit1 + M_Random() % 2;
+        return sfx_bgsit1 + M_CosmeticRandom() % 2;
     else if (sound >= sfx_podth1 && sound <= sfx_podth3)
-        return sfx_podth1 + M_Random() % 3;
+        return sfx_podth1 + M_CosmeticRandom() % 3;
     else if (sound == sfx_bgdth1 || sound == sfx_bgdth2)
-        return sfx_bgdth1 + M_Random() % 2;
+        return sfx_bgdth1 + M_CosmeticRandom() % 2;
     else
         return sound;
 }
@@ -511,7 +511,7 @@ static void F_CastTicker(void)
         if (!castdeath && caststate == &states[S_PLAY_ATK1])
             goto stopattack;    // Oh, gross hack!
 
-        st = (caststate->action == A_RandomJump && M_Random() < caststate->misc2 ? caststate->misc1 : caststate->nextstate);
+        st = (caststate->action == A_RandomJump && M_CosmeticRandom() < caststate->misc2 ? caststate->misc1 : caststate->nextstate);
         caststate = &states[st];
         castframes++;
 
@@ -639,7 +639,7 @@ stopattack:
     {
         if (caststate->action == A_RandomJump)
         {
-            caststate = &states[M_Random() < caststate->misc2 ? caststate->misc1 : caststate->nextstate];
+            caststate = &states[M_CosmeticRandom() < caststate->misc2 ? caststate->misc1 : caststate->nextstate];
             casttics = caststate->tics;
         }
 
@@ -708,14 +708,14 @@ static dboolean F_CastResponder(event_t *ev)
     castdeath = true;
 
     if (r_corpses_mirrored && type != MT_CHAINGUY && type != MT_CYBORG)
-        castdeathflip = M_Random() & 1;
+        castdeathflip = M_CosmeticRandom() & 1;
 
     caststate = &states[mobjinfo[type].deathstate];
     casttics = caststate->tics;
 
     if (casttics == -1 && caststate->action == A_RandomJump)
     {
-        caststate = &states[(M_Random() < caststate->misc2 ? caststate->misc1 : caststate->nextstate)];
+        caststate = &states[(M_CosmeticRandom() < caststate->misc2 ? caststate->misc1 : caststate->nextstate)];
         casttics = caststate->tics;
     }
 
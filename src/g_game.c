@@ -588,6 +588,7 @@ void G_DoLoadLevel(void)
     P_MapName(ep, gamemap);
 
     P_SetupLevel(ep, gamemap);
+    WI_StartPrefetch();
 
     R_InitSkyMap();
     R_InitColumnFunctions();
@@ -971,10 +972,14 @@ void G_Ticker(void)
             ST_Ticker();
             AM_Ticker();
             HU_Ticker();
+
+            // [BH] don't read the intermission's lumps in the first second of the map
+            W_LoadQueuedLump(leveltime < TICRATE ? LOADER_LEVEL : LOADER_SPECULATIVE);
             break;
 
         case GS_INTERMISSION:
             WI_Ticker();
+            W_LoadQueuedLump(LOADER_SPECULATIVE);
             break;
 
         case GS_FINALE:
@@ -1343,6 +1348,7 @@ static void G_DoCompleted(void)
 
     C_CCMDOutput("exitmap");
 
+    P_StartPrefetch((gamemode == commercial ? (gamemission == pack_nerve ? 2 : 1) : gameepisode), wminfo.next + 1);
     WI_Start(&wminfo);
 }
 
@@ -165,7 +165,7 @@ static patch_t *HU_LoadHUDAmmoPatch(int ammopicnum)
     int lump;
 
     if ((mobjinfo[ammopic[ammopicnum].mobjnum].flags & MF_SPECIAL) && (lump = W_CheckNumForName(ammopic[ammopicnum].patchname)) >= 0)
-        return W_CacheLumpNum(lump);
+        return W_LockLumpNum(lump);
 
     return NULL;
 }
@@ -175,9 +175,9 @@ static patch_t *HU_LoadHUDKeyPatch(int keypicnum)
     int lump;
 
     if (dehacked && (lump = W_CheckNumForName(keypics[keypicnum].patchnamea)) >= 0)
-        return W_CacheLumpNum(lump);
+        return W_LockLumpNum(lump);
     else if ((lump = W_CheckNumForName(keypics[keypicnum].patchnameb)) >= 0)
-        return W_CacheLumpNum(lump);
+        return W_LockLumpNum(lump);
 
     return NULL;
 }
@@ -214,7 +214,7 @@ void HU_Init(void)
         char    buffer[9];
 
         M_snprintf(buffer, sizeof(buffer), "STCFN%.3d", j++);
-        hu_font[i] = W_CacheLumpName(buffer);
+        hu_font[i] = W_LockLumpName(buffer);
     }
 
     caretcolor = FindDominantColor(hu_font['A' - HU_FONTSTART]);
@@ -224,16 +224,16 @@ void HU_Init(void)
         {
             patch_t *patch = W_CacheLumpName("STTNUM0");
 
-            minuspatch = W_CacheLumpName("STTMINUS");
+            minuspatch = W_LockLumpName("STTMINUS");
             minuspatchwidth = SHORT(minuspatch->width);
             minuspatchy = (SHORT(patch->height) - SHORT(minuspatch->height)) / 2;
         }
 
     if ((lump = W_CheckNumForName("ARM1A0")) >= 0)
-        greenarmorpatch = W_CacheLumpNum(lump);
+        greenarmorpatch = W_LockLumpNum(lump);
 
     if ((lump = W_CheckNumForName("ARM2A0")) >= 0)
-        bluearmorpatch = W_CacheLumpNum(lump);
+        bluearmorpatch = W_LockLumpNum(lump);
 
     for (int i = 0; i < NUMAMMO; i++)
         ammopic[i].patch = HU_LoadHUDAmmoPatch(i);
@@ -251,7 +251,7 @@ void HU_Init(void)
 
     if ((lump = W_CheckNumForName(M_CheckParm("-cdrom") ? "STCDROM" : "STDISK")) >= 0)
     {
-        stdisk = W_CacheLumpNum(lump);
+        stdisk = W_LockLumpNum(lump);
         stdiskwidth = SHORT(stdisk->width);
     }
 
@@ -653,22 +653,22 @@ static void HU_AltInit(void)
     for (int i = 0; i < 10; i++)
     {
         M_snprintf(buffer, sizeof(buffer), "DRHUD%i", i);
-        altnum[i] = W_CacheLumpName(buffer);
+        altnum[i] = W_LockLumpName(buffer);
         M_snprintf(buffer, sizeof(buffer), "DRHUD%i_2", i);
-        altnum2[i] = W_CacheLumpName(buffer);
+        altnum2[i] = W_LockLumpName(buffer);
     }
 
-    altminuspatch = W_CacheLumpName("DRHUDNEG");
+    altminuspatch = W_LockLumpName("DRHUDNEG");
     altminuspatchwidth = SHORT(altminuspatch->width);
 
-    altarmpatch = W_CacheLumpName("DRHUDARM");
+    altarmpatch = W_LockLumpName("DRHUDARM");
 
-    altendpatch = W_CacheLumpName("DRHUDE");
-    altmarkpatch = W_CacheLumpName("DRHUDI");
-    altmark2patch = W_CacheLumpName("DRHUDI_2");
+    altendpatch = W_LockLumpName("DRHUDE");
+    altmarkpatch = W_LockLumpName("DRHUDI");
+    altmark2patch = W_LockLumpName("DRHUDI_2");
 
-    altkeypatch = W_CacheLumpName("DRHUDKEY");
-    altskullpatch = W_CacheLumpName("DRHUDSKU");
+    altkeypatch = W_LockLumpName("DRHUDKEY");
+    altskullpatch = W_LockLumpName("DRHUDSKU");
 
     for (int i = 0; i < NUMCARDS; i++)
         if (lumpinfo[i]->wadfile->type == PWAD)
@@ -689,11 +689,11 @@ static void HU_AltInit(void)
     for (int i = 1; i < NUMWEAPONS; i++)
     {
         M_snprintf(buffer, sizeof(buffer), "DRHUDWP%i", i);
-        altweapon[i] = W_CacheLumpName(buffer);
+        altweapon[i] = W_LockLumpName(buffer);
     }
 
-    altleftpatch = W_CacheLumpName("DRHUDL");
-    altrightpatch = W_CacheLumpName("DRHUDR");
+    altleftpatch = W_LockLumpName("DRHUDL");
+    altrightpatch = W_LockLumpName("DRHUDR");
 
     white = nearestcolors[WHITE];
     gray = nearestcolors[GRAY];
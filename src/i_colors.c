@@ -38,8 +38,12 @@
 
 #include <stdlib.h>
 
+#include "SDL.h"
+
 #include "i_colors.h"
 #include "i_swap.h"
+#include "i_system.h"
+#include "m_misc.h"
 #include "w_wad.h"
 #include "z_zone.h"
 
@@ -104,26 +108,91 @@ byte    *tinttabblue25;
 byte    nearestcolors[256];
 byte    nearestblack;
 
-int FindNearestColor(byte *palette, int red, int green, int blue)
+// [BH] The RGB color space is divided into a 32x32x32 cube, and each cell of
+//  the cube lists the only palette colors that could possibly be nearest to a
+//  color within it. A color can be ruled out if even its closest point in the
+//  cell is further away than the furthest point of some other color, using the
+//  fact that the weights of the red and blue terms below are between 2 and 3.
+#define CUBEBITS    5
+#define CUBESIZE    (1 << CUBEBITS)
+#define CUBESHIFT   (8 - CUBEBITS)
+
+static byte *cubepalette;
+static int  cubestart[CUBESIZE * CUBESIZE * CUBESIZE + 1];
+static byte *cubecolors;
+static int  maxcubecolors;
+
+static void BuildPaletteCube(byte *palette)
+{
+    static int  mindist[CUBESIZE][256];
+    static int  maxdist[CUBESIZE][256];
+    int         numcubecolors = 0;
+    int         cell = 0;
+
+    for (int i = 0; i < CUBESIZE; i++)
+    {
+        const int   lo = i << CUBESHIFT;
+        const int   hi = lo + (1 << CUBESHIFT) - 1;
+
+        for (int c = 0; c < 256; c++)
+        {
+            const int   dmin = (c < lo ? lo - c : (c > hi ? c - hi : 0));
+            const int   dmax = MAX(ABS(c - lo), ABS(c - hi));
+
+            mindist[i][c] = dmin * dmin;
+            maxdist[i][c] = dmax * dmax;
+        }
+    }
+
+    for (int r = 0; r < CUBESIZE; r++)
+        for (int g = 0; g < CUBESIZE; g++)
+            for (int b = 0; b < CUBESIZE; b++)
+            {
+                int bound = INT_MAX;
+
+                for (int i = 0; i < 256; i++)
+                    bound = MIN(bound, 3 * maxdist[r][palette[i * 3]] + 4 * maxdist[g][palette[i * 3 + 1]]
+                        + 3 * maxdist[b][palette[i * 3 + 2]]);
+
+                cubestart[cell++] = numcubecolors;
+
+                for (int i = 0; i < 256; i++)
+                    if (2 * mindist[r][palette[i * 3]] + 4 * mindist[g][palette[i * 3 + 1]]
+                        + 2 * mindist[b][palette[i * 3 + 2]] <= bound)
+                    {
+                        if (numcubecolors == maxcubecolors)
+                            cubecolors = I_Realloc(cubecolors, (maxcubecolors += 65536) * sizeof(*cubecolors));
+
+                        cubecolors[numcubecolors++] = i;
+                    }
+            }
+
+    cubestart[cell] = numcubecolors;
+    cubepalette = palette;
+}
+
+static int FindNearestColorInList(byte *palette, int red, int green, int blue, byte *colors, int numcolors)
 {
     int best_difference = INT_MAX;
     int best_color = 0;
 
-    for (int i = 0; i < 256; i++)
+    for (int j = 0; j < numcolors; j++)
     {
-        int r1 = red;
-        int g1 = green;
-        int b1 = blue;
-        int r2 = *palette++;
-        int g2 = *palette++;
-        int b2 = *palette++;
+        int     i = (colors ? colors[j] : j);
+        byte    *color = &palette[i * 3];
+        int     r1 = red;
+        int     g1 = green;
+        int     b1 = blue;
+        int     r2 = color[0];
+        int     g2 = color[1];
+        int     b2 = color[2];
 
         // From <https://www.compuphase.com/cmetric.htm>
-        int rmean = (r1 + r2) / 2;
-        int r = r1 - r2;
-        int g = g1 - g2;
-        int b = b1 - b2;
-        int difference = (((512 + rmean) * r * r) >> 8) + 4 * g * g + (((767 - rmean) * b * b) >> 8);
+        int     rmean = (r1 + r2) / 2;
+        int     r = r1 - r2;
+        int     g = g1 - g2;
+        int     b = b1 - b2;
+        int     difference = (((512 + rmean) * r * r) >> 8) + 4 * g * g + (((767 - rmean) * b * b) >> 8);
 
         if (!difference)
             return i;
@@ -137,6 +206,21 @@ int FindNearestColor(byte *palette, int red, int green, int blue)
     return best_color;
 }
 
+int FindNearestColor(byte *palette, int red, int green, int blue)
+{
+    int cell;
+
+    if ((red | green | blue) & ~255)
+        return FindNearestColorInList(palette, red, green, blue, NULL, 256);
+
+    if (palette != cubepalette)
+        BuildPaletteCube(palette);
+
+    cell = ((((red >> CUBESHIFT) << CUBEBITS) + (green >> CUBESHIFT)) << CUBEBITS) + (blue >> CUBESHIFT);
+
+    return FindNearestColorInList(palette, red, green, blue, &cubecolors[cubestart[cell]], cubestart[cell + 1] - cubestart[cell]);
+}
+
 void FindNearestColors(byte *palette)
 {
     if (W_CheckMultipleLumps("PLAYPAL") > 1)
@@ -250,30 +334,161 @@ static byte *GenerateTintTable(byte *palette, int percent, byte filter[256], int
     return result;
 }
 
+// [BH] every tint table generated by I_InitTintTables()
+static struct
+{
+    byte    **table;
+    int     percent;
+    int     colors;
+} tinttabs[] =
+{
+    { &tinttab20,         20,       ALL                      },
+    { &tinttab25,         25,       ALL                      },
+    { &tinttab33,         33,       ALL                      },
+    { &tinttab40,         40,       ALL                      },
+    { &tinttab50,         50,       ALL                      },
+    { &tinttab60,         60,       ALL                      },
+    { &tinttab66,         66,       ALL                      },
+    { &tinttab75,         75,       ALL                      },
+    { &tinttabadditive,   ADDITIVE, ALL                      },
+    { &tinttabred,        ADDITIVE, REDS                     },
+    { &tinttabredwhite1,  ADDITIVE, (REDS | WHITES)          },
+    { &tinttabredwhite2,  ADDITIVE, (REDS | WHITES | EXTRAS) },
+    { &tinttabgreen,      ADDITIVE, GREENS                   },
+    { &tinttabblue,       ADDITIVE, BLUES                    },
+    { &tinttabred33,      33,       REDS                     },
+    { &tinttabredwhite50, 50,       (REDS | WHITES)          },
+    { &tinttabgreen33,    33,       GREENS                   },
+    { &tinttabblue25,     25,       BLUES                    }
+};
+
+#define TINTTABCACHE        "tinttabs.dat"
+#define TINTTABCACHEID      "TINT"
+#define TINTTABCACHEVERSION 1
+
+static byte         *tinttabpalette;
+static SDL_atomic_t nexttinttab;
+
+static int SDLCALL GenerateTintTables(void *data)
+{
+    int i;
+
+    while ((i = SDL_AtomicAdd(&nexttinttab, 1)) < (int)arrlen(tinttabs))
+        *tinttabs[i].table = GenerateTintTable(tinttabpalette, tinttabs[i].percent, general, tinttabs[i].colors);
+
+    return 0;
+}
+
+//
+// HashTintTables
+// [BH] Identifies the palette and the settings that the tint tables were
+//  generated with, so the cache on disk is rebuilt whenever either changes.
+//
+static unsigned int HashTintTables(byte *palette)
+{
+    unsigned int    hash = 2166136261u;
+
+    for (int i = 0; i < 256 * 3; i++)
+        hash = (hash ^ palette[i]) * 16777619u;
+
+    for (int i = 0; i < 256; i++)
+        hash = (hash ^ general[i]) * 16777619u;
+
+    for (int i = 0; i < (int)arrlen(tinttabs); i++)
+        hash = (((hash ^ (tinttabs[i].percent & 0xFF)) * 16777619u) ^ tinttabs[i].colors) * 16777619u;
+
+    return ((hash ^ TINTTABCACHEVERSION) * 16777619u);
+}
+
+static dboolean LoadTintTables(const char *filename, unsigned int hash)
+{
+    FILE            *file = fopen(filename, "rb");
+    char            id[4];
+    unsigned int    filehash;
+    dboolean        result = false;
+
+    if (!file)
+        return false;
+
+    if (fread(id, 1, sizeof(id), file) == sizeof(id) && !memcmp(id, TINTTABCACHEID, sizeof(id))
+        && fread(&filehash, sizeof(filehash), 1, file) == 1 && filehash == hash)
+    {
+        int i = 0;
+
+        for (; i < (int)arrlen(tinttabs); i++)
+        {
+            *tinttabs[i].table = malloc(256 * 256);
+
+            if (fread(*tinttabs[i].table, 1, 256 * 256, file) != 256 * 256)
+                break;
+        }
+
+        if (!(result = (i == (int)arrlen(tinttabs))))
+            for (; i >= 0; i--)
+            {
+                free(*tinttabs[i].table);
+                *tinttabs[i].table = NULL;
+            }
+    }
+
+    fclose(file);
+    return result;
+}
+
+static void SaveTintTables(const char *filename, unsigned int hash)
+{
+    FILE    *file = fopen(filename, "wb");
+
+    if (!file)
+        return;
+
+    fwrite(TINTTABCACHEID, 1, 4, file);
+    fwrite(&hash, sizeof(hash), 1, file);
+
+    for (int i = 0; i < (int)arrlen(tinttabs); i++)
+        fwrite(*tinttabs[i].table, 1, 256 * 256, file);
+
+    fclose(file);
+}
+
 void I_InitTintTables(byte *palette)
 {
-    int lump = W_CheckNumForName("TRANMAP");
-
-    tinttab20 = GenerateTintTable(palette, 20, general, ALL);
-    tinttab25 = GenerateTintTable(palette, 25, general, ALL);
-    tinttab33 = GenerateTintTable(palette, 33, general, ALL);
-    tinttab40 = GenerateTintTable(palette, 40, general, ALL);
-    tinttab50 = GenerateTintTable(palette, 50, general, ALL);
-    tinttab60 = GenerateTintTable(palette, 60, general, ALL);
-    tinttab66 = GenerateTintTable(palette, 66, general, ALL);
-    tinttab75 = GenerateTintTable(palette, 75, general, ALL);
-
-    tranmap = (lump != -1 ? W_CacheLumpNum(lump) : tinttab50);
-
-    tinttabadditive = GenerateTintTable(palette, ADDITIVE, general, ALL);
-    tinttabred = GenerateTintTable(palette, ADDITIVE, general, REDS);
-    tinttabredwhite1 = GenerateTintTable(palette, ADDITIVE, general, (REDS | WHITES));
-    tinttabredwhite2 = GenerateTintTable(palette, ADDITIVE, general, (REDS | WHITES | EXTRAS));
-    tinttabgreen = GenerateTintTable(palette, ADDITIVE, general, GREENS);
-    tinttabblue = GenerateTintTable(palette, ADDITIVE, general, BLUES);
-
-    tinttabred33 = GenerateTintTable(palette, 33, general, REDS);
-    tinttabredwhite50 = GenerateTintTable(palette, 50, general, (REDS | WHITES));
-    tinttabgreen33 = GenerateTintTable(palette, 33, general, GREENS);
-    tinttabblue25 = GenerateTintTable(palette, 25, general, BLUES);
+    int             lump = W_CheckNumForName("TRANMAP");
+    char            *appdatafolder = M_GetAppDataFolder();
+    char            *filename = M_StringJoin(appdatafolder, DIR_SEPARATOR_S, TINTTABCACHE, NULL);
+    unsigned int    hash = HashTintTables(palette);
+
+    // [BH] reuse the tint tables from the last time this palette was used, or
+    //  otherwise generate them across as many threads as there are cores
+    if (!LoadTintTables(filename, hash))
+    {
+        SDL_Thread  *threads[arrlen(tinttabs)];
+        int         numthreads = BETWEEN(1, SDL_GetCPUCount(), (int)arrlen(tinttabs)) - 1;
+
+        // build this before any threads use it
+        FindNearestColor(palette, 0, 0, 0);
+
+        tinttabpalette = palette;
+        SDL_AtomicSet(&nexttinttab, 0);
+
+        for (int i = 0; i < numthreads; i++)
+            threads[i] = SDL_CreateThread(GenerateTintTables, "GenerateTintTables", NULL);
+
+        GenerateTintTables(NULL);
+
+        for (int i = 0; i < numthreads; i++)
+            if (threads[i])
+                SDL_WaitThread(threads[i], NULL);
+
+        M_MakeDirectory(appdatafolder);
+        SaveTintTables(filename, hash);
+    }
+
+    tranmap = (lump != -1 ? W_LockLumpNum(lump) : tinttab50);
+
+    free(filename);
+
+#if !defined(__APPLE__)
+    free(appdatafolder);
+#endif
 }
@@ -52,6 +52,7 @@ void I_ShutdownWindows32(void);
 #include "m_misc.h"
 #include "s_sound.h"
 #include "version.h"
+#include "z_zone.h"
 
 extern dboolean returntowidescreen;
 
@@ -286,14 +287,23 @@ void I_Error(const char *error, ...)
 //
 // I_Realloc
 //
-void *I_Realloc(void *ptr, size_t size)
+void *I_ReallocEx(void *ptr, size_t size, const char *file, int line)
 {
     void    *newp = realloc(ptr, size);
 
     if (!newp && size)
         I_Error("I_Realloc: Failure trying to reallocate %i bytes", size);
-    else
-        ptr = newp;
 
-    return ptr;
+    Z_TrackArray(ptr, newp, size, file, line);
+    return newp;
+}
+
+//
+// I_Free
+// [BH] Free an array allocated by I_Realloc().
+//
+void I_Free(void *ptr)
+{
+    Z_TrackArray(ptr, NULL, 0, NULL, 0);
+    free(ptr);
 }
@@ -57,6 +57,9 @@ void I_Error(const char *error, ...);
 void I_PrintWindowsVersion(void);
 void I_PrintSystemInfo(void);
 
-void *I_Realloc(void *ptr, size_t size);
+void *I_ReallocEx(void *ptr, size_t size, const char *file, int line);
+void I_Free(void *ptr);
+
+#define I_Realloc(ptr, size)    I_ReallocEx(ptr, size, __FILE__, __LINE__)
 
 #endif
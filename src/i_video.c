@@ -70,7 +70,7 @@
 #define MAXUPSCALEWIDTH     (1600 / ORIGINALWIDTH)
 #define MAXUPSCALEHEIGHT    (1200 / ORIGINALHEIGHT)
 
-#define SHAKEANGLE          ((double)M_RandomInt(-1000, 1000) * r_shake_damage / 100000.0)
+#define SHAKEANGLE          ((double)M_CosmeticRandomInt(-1000, 1000) * r_shake_damage / 100000.0)
 
 #if !defined(SDL_VIDEO_RENDER_D3D11)
 #define SDL_VIDEO_RENDER_D3D11  0
@@ -1898,7 +1898,7 @@ void I_InitGraphics(void)
     keys['a'] = keys['A'] = false;
     keys['l'] = keys['L'] = false;
 
-    PLAYPAL = W_CacheLumpName("PLAYPAL");
+    PLAYPAL = W_LockLumpName("PLAYPAL");
     I_InitTintTables(PLAYPAL);
     FindNearestColors(PLAYPAL);
 
@@ -120,6 +120,7 @@ static default_t cvars[] =
     CONFIG_VARIABLE_INT          (infighting,                                        BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (infiniteheight,                                    BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_STRING       (iwadfolder,                                        NOVALUEALIAS       ),
+    CONFIG_VARIABLE_INT          (lazymonsters,                                      BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (m_acceleration,                                    BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (m_doubleclick_use,                                 BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (m_invertyaxis,                                     BOOLVALUEALIAS     ),
@@ -159,6 +160,7 @@ static default_t cvars[] =
     CONFIG_VARIABLE_INT          (r_liquid_lowerview,                                BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_liquid_swirl,                                    BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_OTHER        (r_lowpixelsize,                                    NOVALUEALIAS       ),
+    CONFIG_VARIABLE_INT          (r_mipmaps,                                         BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_mirroredweapons,                                 BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_playersprites,                                   BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_rockettrails,                                    BOOLVALUEALIAS     ),
@@ -660,6 +662,9 @@ static void M_CheckCVARs(void)
     if (!*iwadfolder || M_StringCompare(iwadfolder, iwadfolder_default) || !M_FolderExists(iwadfolder))
         D_InitIWADFolder();
 
+    if (lazymonsters != false && lazymonsters != true)
+        lazymonsters = lazymonsters_default;
+
     if (m_acceleration != false && m_acceleration != true)
         m_acceleration = m_acceleration_default;
 
@@ -768,6 +773,9 @@ static void M_CheckCVARs(void)
     if (r_liquid_swirl != false && r_liquid_swirl != true)
         r_liquid_swirl = r_liquid_swirl_default;
 
+    if (r_mipmaps != false && r_mipmaps != true)
+        r_mipmaps = r_mipmaps_default;
+
     if (r_mirroredweapons != false && r_mirroredweapons != true)
         r_mirroredweapons = r_mirroredweapons_default;
 
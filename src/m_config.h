@@ -87,6 +87,7 @@ extern int          gp_vibrate_weapons;
 extern dboolean     infighting;
 extern dboolean     infiniteheight;
 extern char         *iwadfolder;
+extern dboolean     lazymonsters;
 extern dboolean     m_acceleration;
 extern dboolean     m_doubleclick_use;
 extern dboolean     m_invertyaxis;
@@ -127,6 +128,7 @@ extern dboolean     r_liquid_current;
 extern dboolean     r_liquid_lowerview;
 extern dboolean     r_liquid_swirl;
 extern char         *r_lowpixelsize;
+extern dboolean     r_mipmaps;
 extern dboolean     r_mirroredweapons;
 extern dboolean     r_playersprites;
 extern dboolean     r_rockettrails;
@@ -417,6 +419,8 @@ enum
 #define iwadfolder_default                      "/"
 #endif
 
+#define lazymonsters_default                    false
+
 #define m_acceleration_default                  true
 
 #define m_doubleclick_use_default               false
@@ -515,6 +519,8 @@ enum
 
 #define r_lowpixelsize_default                  "2x2"
 
+#define r_mipmaps_default                       false
+
 #define r_mirroredweapons_default               false
 
 #define r_playersprites_default                 true
@@ -501,9 +501,10 @@ static void BlurScreen(byte *screen, byte *blurscreen)
 //
 void M_DarkBackground(void)
 {
-    static byte blurscreen1[SCREENWIDTH * SCREENHEIGHT];
-    static byte blurscreen2[(SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH];
-    static int  prevtic;
+    static byte         blurscreen1[SCREENWIDTH * SCREENHEIGHT];
+    static byte         blurscreen2[(SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH];
+    static int          prevtic;
+    static unsigned int seed;
 
     blurheight = (SCREENHEIGHT - (vid_widescreen && gamestate == GS_LEVEL) * SBARHEIGHT) * SCREENWIDTH;
 
@@ -518,7 +519,7 @@ void M_DarkBackground(void)
         }
 
         for (int i = 0; i < blurheight; i++)
-            screens[0][i] = colormaps[0][((M_Random() & 7) << 8) + screens[0][i]];
+            screens[0][i] = colormaps[0][((M_RenderRandom(&seed) & 7) << 8) + screens[0][i]];
 
         BlurScreen(screens[0], blurscreen1);
 
@@ -536,7 +537,7 @@ void M_DarkBackground(void)
             }
 
             for (int i = 0; i < (SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH; i++)
-                mapscreen[i] = colormaps[0][((M_Random() & 7) << 8) + mapscreen[i]];
+                mapscreen[i] = colormaps[0][((M_RenderRandom(&seed) & 7) << 8) + mapscreen[i]];
 
             BlurScreen(mapscreen, blurscreen2);
 
@@ -1940,9 +1941,9 @@ static void M_QuitResponse(int key)
         int i = 30;
 
         if (gamemode == commercial)
-            S_StartSound(NULL, quitsounds2[M_Random() & 7]);
+            S_StartSound(NULL, quitsounds2[M_CosmeticRandom() & 7]);
         else
-            S_StartSound(NULL, quitsounds[M_Random() & 7]);
+            S_StartSound(NULL, quitsounds[M_CosmeticRandom() & 7]);
 
         // wait until all sounds stopped or 3 seconds has passed
         while (i-- > 0 && I_AnySoundStillPlaying())
@@ -1971,7 +1972,7 @@ void M_QuitDOOM(int choice)
     if (deh_strlookup[p_QUITMSG].assigned == 2)
         M_StringCopy(line1, s_QUITMSG, sizeof(line1));
     else
-        M_snprintf(line1, sizeof(line1), *endmsg[M_Random() % NUM_QUITMESSAGES + (gamemission != doom) * NUM_QUITMESSAGES], OS);
+        M_snprintf(line1, sizeof(line1), *endmsg[M_CosmeticRandom() % NUM_QUITMESSAGES + (gamemission != doom) * NUM_QUITMESSAGES], OS);
 
     M_snprintf(line2, sizeof(line2), (usinggamepad ? s_DOSA : s_DOSY), OS);
     M_snprintf(endstring, sizeof(endstring), "%s\n\n%s", line1, line2);
@@ -36,38 +36,84 @@
 ========================================================================
 */
 
+// [BH] Gameplay decisions are made using M_Random() and friends, and nothing
+//  else may draw from that seed, so that how often the screen is refreshed has
+//  no effect on them. Effects with no bearing on gameplay use the cosmetic
+//  seed instead, and anything done per pixel is given its own seed by its
+//  caller, so that each rendering thread can keep one of its own.
 static unsigned int seed;
+static unsigned int cosmeticseed;
 
-static unsigned int fastrand(void)
+static unsigned int fastrand(unsigned int *state)
 {
-    return (((seed = 214013 * seed + 2531011) >> 16));
+    return (((*state = 214013 * *state + 2531011) >> 16));
+}
+
+static int randomint(unsigned int *state, int lower, int upper)
+{
+    return (fastrand(state) % (upper - lower + 1) + lower);
+}
+
+static int randomintnorepeat(unsigned int *state, int lower, int upper, int previous)
+{
+    int result;
+
+    while ((result = randomint(state, lower, upper)) == previous);
+
+    return result;
 }
 
 int M_Random(void)
 {
-    return (fastrand() & 255);
+    return (fastrand(&seed) & 255);
 }
 
 int M_SubRandom(void)
 {
-    return ((fastrand() & 510) - 255);
+    return ((fastrand(&seed) & 510) - 255);
 }
 
 int M_RandomInt(int lower, int upper)
 {
-    return (fastrand() % (upper - lower + 1) + lower);
+    return randomint(&seed, lower, upper);
 }
 
 int M_RandomIntNoRepeat(int lower, int upper, int previous)
 {
-    int randomint;
-
-    while ((randomint = M_RandomInt(lower, upper)) == previous);
-
-    return randomint;
+    return randomintnorepeat(&seed, lower, upper, previous);
 }
 
 void M_Seed(unsigned int value)
 {
     seed = value;
 }
+
+int M_CosmeticRandom(void)
+{
+    return (fastrand(&cosmeticseed) & 255);
+}
+
+int M_CosmeticRandomInt(int lower, int upper)
+{
+    return randomint(&cosmeticseed, lower, upper);
+}
+
+int M_CosmeticRandomIntNoRepeat(int lower, int upper, int previous)
+{
+    return randomintnorepeat(&cosmeticseed, lower, upper, previous);
+}
+
+void M_CosmeticSeed(unsigned int value)
+{
+    cosmeticseed = value;
+}
+
+int M_RenderRandom(unsigned int *state)
+{
+    return (fastrand(state) & 255);
+}
+
+int M_RenderRandomInt(unsigned int *state, int lower, int upper)
+{
+    return randomint(state, lower, upper);
+}
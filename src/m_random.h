@@ -45,4 +45,12 @@ int M_RandomInt(int lower, int upper);
 int M_RandomIntNoRepeat(int lower, int upper, int previous);
 void M_Seed(unsigned int value);
 
+int M_CosmeticRandom(void);
+int M_CosmeticRandomInt(int lower, int upper);
+int M_CosmeticRandomIntNoRepeat(int lower, int upper, int previous);
+void M_CosmeticSeed(unsigned int value);
+
+int M_RenderRandom(unsigned int *state);
+int M_RenderRandomInt(unsigned int *state, int lower, int upper);
+
 #endif
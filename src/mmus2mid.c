@@ -343,7 +343,7 @@ dboolean mmus2mid(UBYTE *mus, size_t size, MIDI *mididata)
         track[i].velocity = 64;
         track[i].deltaT = 0;
         track[i].lastEvt = 0;
-        free(mididata->track[i].data);      // jff 3/5/98 remove old allocations
+        I_Free(mididata->track[i].data);    // jff 3/5/98 remove old allocations
         mididata->track[i].data = NULL;
         track[i].alloced = 0;
         mididata->track[i].len = 0;
@@ -520,7 +520,7 @@ dboolean mmus2mid(UBYTE *mus, size_t size, MIDI *mididata)
         }
         else
         {
-            free(mididata->track[i].data);
+            I_Free(mididata->track[i].data);
             mididata->track[i].data = NULL;
         }
     }
@@ -553,7 +553,7 @@ static void TWriteLength(UBYTE **midiptr, size_t length)
 void FreeMIDIData(MIDI *mididata)
 {
     for (int i = 0; i < arrlen(mididata->track); i++)
-        free(mididata->track[i].data);
+        I_Free(mididata->track[i].data);
 
     memset(mididata, 0, sizeof(*mididata));
 }
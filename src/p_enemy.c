@@ -52,11 +52,18 @@
 #include "p_tick.h"
 #include "s_sound.h"
 
-#define BARRELRANGE (512 * FRACUNIT)
+#define BARRELRANGE     (512 * FRACUNIT)
+
+#define LAZYDISTANCE    (2048 * FRACUNIT)
+#define LAZYTHINKS      4
 
 int             barrelms = 0;
 static mobj_t   *current_actor;
 
+dboolean        lazymonsters = lazymonsters_default;
+
+extern dboolean vanilla;
+
 void A_Fall(mobj_t *actor, player_t *player, pspdef_t *psp);
 
 //
@@ -169,6 +176,30 @@ static dboolean P_HitFriend(mobj_t *actor)
     return (linetarget && linetarget != target && !((linetarget->flags ^ actor->flags) & MF_FRIEND));
 }
 
+//
+// P_IsLazy
+// [BH] If the lazymonsters CVAR is on, monsters that are far away from the
+//  player and haven't seen them yet only look for the player and think about
+//  attacking every few times, rather than every time.
+//
+static dboolean P_IsLazy(mobj_t *actor)
+{
+    mobj_t  *mo = viewplayer->mo;
+
+    if (!lazymonsters || vanilla || (actor->flags2 & MF2_SEENPLAYER)
+        || P_ApproxDistance(actor->x - mo->x, actor->y - mo->y) <= LAZYDISTANCE)
+    {
+        actor->lazycount = 0;
+        return false;
+    }
+
+    if (++actor->lazycount < LAZYTHINKS)
+        return true;
+
+    actor->lazycount = 0;
+    return false;
+}
+
 //
 // P_CheckMissileRange
 //
@@ -181,6 +212,9 @@ static dboolean P_CheckMissileRange(mobj_t *actor)
     if (!P_CheckSight(actor, target))
         return false;
 
+    if (target->player)
+        actor->flags2 |= MF2_SEENPLAYER;
+
     if (actor->flags & MF_JUSTHIT)
     {
         // the target just hit the enemy, so fight back!
@@ -763,6 +797,8 @@ static dboolean P_LookForPlayer(mobj_t *actor, dboolean allaround)
         return false;
     }
 
+    actor->flags2 |= MF2_SEENPLAYER;
+
     if (!allaround)
     {
         const angle_t   an = R_PointToAngle2(actor->x, actor->y, mo->x, mo->y) - actor->angle;
@@ -896,7 +932,7 @@ void A_Look(mobj_t *actor, player_t *player, pspdef_t *psp)
         && P_LookForTargets(actor, false))
         && !(target && (target->flags & MF_SHOOTABLE) && (P_SetTarget(&actor->target, target),
             !(actor->flags & MF_AMBUSH) || P_CheckSight(actor, target)))
-        && ((actor->flags & MF_FRIEND) || !P_LookForTargets(actor, false)))
+        && ((actor->flags & MF_FRIEND) || P_IsLazy(actor) || !P_LookForTargets(actor, false)))
         return;
 
     // go into chase state
@@ -984,6 +1020,15 @@ void A_Chase(mobj_t *actor, player_t *player, pspdef_t *psp)
         return;
     }
 
+    // [BH] keep moving, but don't think about attacking or changing targets
+    if (P_IsLazy(actor))
+    {
+        if (--actor->movecount < 0 || !P_SmartMove(actor))
+            P_NewChaseDir(actor);
+
+        return;
+    }
+
     // check for melee attack
     if (info->meleestate && P_CheckMeleeRange(actor))
     {
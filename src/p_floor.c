@@ -73,6 +73,9 @@ result_e T_MovePlane(sector_t *sector, fixed_t speed, fixed_t dest, dboolean cru
 
     sector->oldgametime = gametime;
 
+    // [BH] lines of sight may have changed
+    P_FlushSightCache();
+
     switch (floororceiling)
     {
         case FLOOR:
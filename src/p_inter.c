@@ -1816,7 +1816,7 @@ void P_KillMobj(mobj_t *target, mobj_t *inflicter, mobj_t *source)
         if (!(target->flags & MF_FUZZ))
             target->bloodsplats = CORPSEBLOODSPLATS;
 
-        if (r_corpses_mirrored && (type != MT_CHAINGUY && type != MT_CYBORG) && (M_Random() & 1))
+        if (r_corpses_mirrored && (type != MT_CHAINGUY && type != MT_CYBORG) && (M_CosmeticRandom() & 1))
             target->flags2 |= MF2_MIRRORED;
     }
 
@@ -1898,7 +1898,7 @@ void P_KillMobj(mobj_t *target, mobj_t *inflicter, mobj_t *source)
         mo->angle = target->angle + (M_SubRandom() << 20);
         mo->flags |= MF_DROPPED;    // special versions of items
 
-        if (r_mirroredweapons && (M_Random() & 1))
+        if (r_mirroredweapons && (M_CosmeticRandom() & 1))
             mo->flags2 |= MF2_MIRRORED;
     }
 }
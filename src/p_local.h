@@ -205,6 +205,8 @@ dboolean P_BlockThingsIterator(int x, int y, dboolean func(mobj_t *));
 extern divline_t    dltrace;
 
 dboolean P_PathTraverse(fixed_t x1, fixed_t y1, fixed_t x2, fixed_t y2, int flags, dboolean (*trav)(intercept_t *));
+void P_StartTraceBatch(fixed_t x, fixed_t y);
+void P_EndTraceBatch(void);
 
 void P_UnsetThingPosition(mobj_t *thing);
 void P_UnsetBloodSplatPosition(bloodsplat_t *splat);
@@ -237,6 +239,7 @@ dboolean P_CheckLineSide(mobj_t *actor, fixed_t x, fixed_t y);
 dboolean P_TeleportMove(mobj_t *thing, fixed_t x, fixed_t y, fixed_t z, dboolean boss);
 void P_SlideMove(mobj_t *mo);
 dboolean P_CheckSight(mobj_t *t1, mobj_t *t2);
+void P_FlushSightCache(void);
 void P_UseLines(void);
 
 dboolean P_ChangeSector(sector_t *sector, dboolean crunch);
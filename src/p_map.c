@@ -1992,7 +1992,7 @@ static void PIT_ChangeSector(mobj_t *thing)
             if (!(flags & MF_FUZZ))
             {
                 int radius = ((spritewidth[sprites[thing->sprite].spriteframes[0].lump[0]] >> FRACBITS) >> 1) + 12;
-                int max = M_RandomInt(50, 100) + radius;
+                int max = M_CosmeticRandomInt(50, 100) + radius;
                 int x = thing->x;
                 int y = thing->y;
                 int blood = mobjinfo[thing->blood].blood;
@@ -2000,9 +2000,9 @@ static void PIT_ChangeSector(mobj_t *thing)
 
                 for (int i = 0; i < max; i++)
                 {
-                    int angle = M_RandomInt(0, FINEANGLES - 1);
-                    int fx = x + FixedMul(M_RandomInt(0, radius) << FRACBITS, finecosine[angle]);
-                    int fy = y + FixedMul(M_RandomInt(0, radius) << FRACBITS, finesine[angle]);
+                    int angle = M_CosmeticRandomInt(0, FINEANGLES - 1);
+                    int fx = x + FixedMul(M_CosmeticRandomInt(0, radius) << FRACBITS, finecosine[angle]);
+                    int fy = y + FixedMul(M_CosmeticRandomInt(0, radius) << FRACBITS, finesine[angle]);
 
                     P_SpawnBloodSplat(fx, fy, blood, floorz, NULL);
                 }
@@ -2012,7 +2012,7 @@ static void PIT_ChangeSector(mobj_t *thing)
 
             thing->flags &= ~MF_SOLID;
 
-            if (r_corpses_mirrored && (M_Random() & 1))
+            if (r_corpses_mirrored && (M_CosmeticRandom() & 1))
                 thing->flags2 |= MF2_MIRRORED;
 
             thing->height = 0;
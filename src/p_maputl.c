@@ -40,6 +40,7 @@
 #include "m_bbox.h"
 #include "p_local.h"
 #include "p_setup.h"
+#include "z_zone.h"
 
 extern msecnode_t   *sector_list;   // phares 3/16/98
 
@@ -251,7 +252,7 @@ void P_UnsetBloodSplatPosition(bloodsplat_t *splat)
     if ((*sprev = snext))
         snext->sprev = sprev;
 
-    free(splat);
+    Z_Free(splat);
 }
 
 //
@@ -422,6 +423,159 @@ static void check_intercept(void)
 
 divline_t   dltrace;
 
+//
+// [BH] Trace batching. When a fan of traces is fired from the same origin
+// (shotgun pellets and the BFG spray), the arc each line and thing subtends
+// as seen from that origin is worked out once and shared by every trace in
+// the fan, so candidates that a trace can't cross are rejected by a single
+// compare instead of the full intercept tests. Anything the arc test can't
+// rule out safely still goes through those tests, so the results are the same.
+//
+#define TRACESPANS  1024
+#define TRACENEAR   (64 * FRACUNIT)
+#define TRACEMARGIN ANG1
+
+typedef struct
+{
+    int         batch;
+    angle_t     start;
+    angle_t     width;
+} linespan_t;
+
+typedef struct
+{
+    mobj_t      *thing;
+    fixed_t     x, y;
+    fixed_t     radius;
+    int         batch;
+    angle_t     start;
+    angle_t     width;
+} thingspan_t;
+
+static dboolean     tracebatching;
+static int          tracebatch;
+static fixed_t      tracebatchx, tracebatchy;
+static dboolean     tracecull;
+static angle_t      traceangle;
+
+static linespan_t   *linespans;
+static int          numlinespans;
+static thingspan_t  thingspans[TRACESPANS];
+
+void P_StartTraceBatch(fixed_t x, fixed_t y)
+{
+    if (numlines > numlinespans)
+    {
+        linespans = I_Realloc(linespans, numlines * sizeof(*linespans));
+        memset(linespans, 0, numlines * sizeof(*linespans));
+        numlinespans = numlines;
+    }
+
+    tracebatching = true;
+    tracebatch++;
+    tracebatchx = x;
+    tracebatchy = y;
+}
+
+void P_EndTraceBatch(void)
+{
+    tracebatching = false;
+    tracecull = false;
+}
+
+static angle_t P_TraceAngle(double dx, double dy)
+{
+    return (angle_t)(int64_t)(atan2(dy, dx) * (ANG180 / M_PI));
+}
+
+// Set the arc subtended by the given points, which must all lie within 180
+// degrees of each other as seen from the trace origin.
+static void P_SetTraceSpan(const double *px, const double *py, int count, angle_t *start, angle_t *width)
+{
+    angle_t first = P_TraceAngle(px[0], py[0]);
+    int     lo = 0;
+    int     hi = 0;
+
+    for (int i = 1; i < count; i++)
+    {
+        int delta = (int)(P_TraceAngle(px[i], py[i]) - first);
+
+        if (delta < lo)
+            lo = delta;
+        else if (delta > hi)
+            hi = delta;
+    }
+
+    *start = first + lo - TRACEMARGIN;
+    *width = (angle_t)hi - lo + TRACEMARGIN * 2;
+}
+
+static dboolean P_LineOutsideTrace(line_t *ld)
+{
+    linespan_t  *span = &linespans[ld - lines];
+
+    if (span->batch != tracebatch)
+    {
+        span->batch = tracebatch;
+
+        // never cull lines passing close to the origin
+        if ((int64_t)dltrace.x > (int64_t)ld->bbox[BOXLEFT] - TRACENEAR
+            && (int64_t)dltrace.x < (int64_t)ld->bbox[BOXRIGHT] + TRACENEAR
+            && (int64_t)dltrace.y > (int64_t)ld->bbox[BOXBOTTOM] - TRACENEAR
+            && (int64_t)dltrace.y < (int64_t)ld->bbox[BOXTOP] + TRACENEAR)
+        {
+            span->start = 0;
+            span->width = UINT_MAX;
+        }
+        else
+        {
+            const double    px[2] = { (double)ld->v1->x - dltrace.x, (double)ld->v2->x - dltrace.x };
+            const double    py[2] = { (double)ld->v1->y - dltrace.y, (double)ld->v2->y - dltrace.y };
+
+            P_SetTraceSpan(px, py, 2, &span->start, &span->width);
+        }
+    }
+
+    return ((angle_t)(traceangle - span->start) > span->width);
+}
+
+static dboolean P_ThingOutsideTrace(mobj_t *thing)
+{
+    thingspan_t *span = &thingspans[((uintptr_t)thing >> 4) & (TRACESPANS - 1)];
+    fixed_t     x = thing->x;
+    fixed_t     y = thing->y;
+    fixed_t     radius = thing->radius;
+
+    if (span->batch != tracebatch || span->thing != thing || span->x != x || span->y != y || span->radius != radius)
+    {
+        const double    dx = (double)x - dltrace.x;
+        const double    dy = (double)y - dltrace.y;
+        const double    r = radius;
+
+        span->thing = thing;
+        span->x = x;
+        span->y = y;
+        span->radius = radius;
+        span->batch = tracebatch;
+
+        // never cull things close to the origin
+        if (fabs(dx) < r + TRACENEAR && fabs(dy) < r + TRACENEAR)
+        {
+            span->start = 0;
+            span->width = UINT_MAX;
+        }
+        else
+        {
+            const double    px[4] = { dx - r, dx + r, dx + r, dx - r };
+            const double    py[4] = { dy - r, dy - r, dy + r, dy + r };
+
+            P_SetTraceSpan(px, py, 4, &span->start, &span->width);
+        }
+    }
+
+    return ((angle_t)(traceangle - span->start) > span->width);
+}
+
 //
 // PIT_AddLineIntercepts.
 // Looks for lines in the given block
@@ -438,6 +592,9 @@ static dboolean PIT_AddLineIntercepts(line_t *ld)
     fixed_t     frac;
     divline_t   dl;
 
+    if (tracecull && P_LineOutsideTrace(ld))
+        return true;
+
     // avoid precision problems with two routines
     if (dltrace.dx > FRACUNIT * 16 || dltrace.dy > FRACUNIT * 16 || dltrace.dx < -FRACUNIT * 16 || dltrace.dy < -FRACUNIT * 16)
     {
@@ -480,6 +637,9 @@ static dboolean PIT_AddThingIntercepts(mobj_t *thing)
     fixed_t     x = thing->x;
     fixed_t     y = thing->y;
 
+    if (tracecull && P_ThingOutsideTrace(thing))
+        return true;
+
     // [RH] Don't check a corner to corner crosssection for hit.
     // Instead, check against the actual bounding box.
 
@@ -615,6 +775,7 @@ dboolean P_PathTraverse(fixed_t x1, fixed_t y1, fixed_t x2, fixed_t y2, int flag
 
     validcount++;
     intercept_p = intercepts;
+    tracecull = (tracebatching && x1 == tracebatchx && y1 == tracebatchy);
 
     if (!((x1 - bmaporgx) & (MAPBLOCKSIZE - 1)))
         x1 += FRACUNIT;         // don't side exactly on a line
@@ -627,6 +788,15 @@ dboolean P_PathTraverse(fixed_t x1, fixed_t y1, fixed_t x2, fixed_t y2, int flag
     dltrace.dx = x2 - x1;
     dltrace.dy = y2 - y1;
 
+    // [BH] short traces use a different crossing test, so aren't culled
+    if (tracecull)
+    {
+        if (dltrace.dx > FRACUNIT * 16 || dltrace.dy > FRACUNIT * 16 || dltrace.dx < -FRACUNIT * 16 || dltrace.dy < -FRACUNIT * 16)
+            traceangle = P_TraceAngle(dltrace.dx, dltrace.dy);
+        else
+            tracecull = false;
+    }
+
     _x1 = (int64_t)x1 - bmaporgx;
     _y1 = (int64_t)y1 - bmaporgy;
     xt1 = (int)(_x1 >> MAPBLOCKSHIFT);
@@ -297,8 +297,8 @@ static void P_XYMovement(mobj_t *mo)
                 if (!mo->bloodsplats)
                     break;
 
-                x = mo->x + (M_RandomInt(-radius, radius) << FRACBITS);
-                y = mo->y + (M_RandomInt(-radius, radius) << FRACBITS);
+                x = mo->x + (M_CosmeticRandomInt(-radius, radius) << FRACBITS);
+                y = mo->y + (M_CosmeticRandomInt(-radius, radius) << FRACBITS);
 
                 P_SpawnBloodSplat(x, y, blood, floorz, mo);
             }
@@ -404,9 +404,9 @@ static void P_ZMovement(mobj_t *mo)
 
                 if (mo->blood != FUZZYBLOOD)
                 {
-                    P_SpawnBloodSplat(x + (M_RandomInt(-3, 3) << FRACBITS), y + (M_RandomInt(-3, 3) << FRACBITS),
+                    P_SpawnBloodSplat(x + (M_CosmeticRandomInt(-3, 3) << FRACBITS), y + (M_CosmeticRandomInt(-3, 3) << FRACBITS),
                         mo->blood, mo->floorz, NULL);
-                    P_SpawnBloodSplat(x + (M_RandomInt(-3, 3) << FRACBITS), y + (M_RandomInt(-3, 3) << FRACBITS),
+                    P_SpawnBloodSplat(x + (M_CosmeticRandomInt(-3, 3) << FRACBITS), y + (M_CosmeticRandomInt(-3, 3) << FRACBITS),
                         mo->blood, mo->floorz, NULL);
                 }
             }
@@ -725,7 +725,7 @@ mobj_t *P_SpawnMobj(fixed_t x, fixed_t y, fixed_t z, mobjtype_t type)
     mobj->pitch = NORM_PITCH;
 
     if ((mobj->flags & MF_SHOOTABLE) && type != MT_PLAYER && type != MT_BARREL)
-        mobj->pitch += M_RandomInt(-16, 16);
+        mobj->pitch += M_CosmeticRandomInt(-16, 16);
 
     // set subsector and/or block links
     P_SetThingPosition(mobj);
@@ -962,15 +962,15 @@ static void P_SpawnMoreBlood(mobj_t *mobj)
     if (blood)
     {
         int radius = ((spritewidth[sprites[mobj->sprite].spriteframes[0].lump[0]] >> FRACBITS) >> 1) + 12;
-        int max = M_RandomInt(50, 100) + radius;
+        int max = M_CosmeticRandomInt(50, 100) + radius;
         int x = mobj->x;
         int y = mobj->y;
         int floorz = mobj->floorz;
 
         if (!(mobj->flags & MF_SPAWNCEILING))
         {
-            x += M_RandomInt(-radius / 3, radius / 3) << FRACBITS;
-            y += M_RandomInt(-radius / 3, radius / 3) << FRACBITS;
+            x += M_CosmeticRandomInt(-radius / 3, radius / 3) << FRACBITS;
+            y += M_CosmeticRandomInt(-radius / 3, radius / 3) << FRACBITS;
         }
 
         for (int i = 0; i < max; i++)
@@ -981,9 +981,9 @@ static void P_SpawnMoreBlood(mobj_t *mobj)
             if (!mobj->bloodsplats)
                 break;
 
-            angle = M_RandomInt(0, FINEANGLES - 1);
-            fx = x + FixedMul(M_RandomInt(0, radius) << FRACBITS, finecosine[angle]);
-            fy = y + FixedMul(M_RandomInt(0, radius) << FRACBITS, finesine[angle]);
+            angle = M_CosmeticRandomInt(0, FINEANGLES - 1);
+            fx = x + FixedMul(M_CosmeticRandomInt(0, radius) << FRACBITS, finecosine[angle]);
+            fy = y + FixedMul(M_CosmeticRandomInt(0, radius) << FRACBITS, finesine[angle]);
 
             P_SpawnBloodSplat(fx, fy, blood, floorz, mobj);
         }
@@ -1117,11 +1117,11 @@ mobj_t *P_SpawnMapThing(mapthing_t *mthing, dboolean spawnmonsters)
             mobj->flags2 |= MF2_BOSS;
 
     // [BH] randomly mirror corpses
-    if ((flags & MF_CORPSE) && r_corpses_mirrored && (M_Random() & 1))
+    if ((flags & MF_CORPSE) && r_corpses_mirrored && (M_CosmeticRandom() & 1))
         mobj->flags2 |= MF2_MIRRORED;
 
     // [BH] randomly mirror weapons
-    if (r_mirroredweapons && (type == SuperShotgun || (type >= Shotgun && type <= BFG9000)) && (M_Random() & 1))
+    if (r_mirroredweapons && (type == SuperShotgun || (type >= Shotgun && type <= BFG9000)) && (M_CosmeticRandom() & 1))
         mobj->flags2 |= MF2_MIRRORED;
 
     // [BH] spawn blood splats around corpses
@@ -1137,7 +1137,7 @@ mobj_t *P_SpawnMapThing(mapthing_t *mthing, dboolean spawnmonsters)
 
     // [crispy] randomly colorize space marine corpse objects
     if (mobj->info->spawnstate == S_PLAY_DIE7 || mobj->info->spawnstate == S_PLAY_XDIE9)
-        mobj->flags |= (M_RandomInt(0, 3) << MF_TRANSSHIFT);
+        mobj->flags |= (M_CosmeticRandomInt(0, 3) << MF_TRANSSHIFT);
 
     if ((mobj->flags2 & MF2_DECORATION) && i != MT_BARREL)
         numdecorations++;
@@ -1168,7 +1168,7 @@ void P_SpawnPuff(fixed_t x, fixed_t y, fixed_t z, angle_t angle)
     th->momz = FRACUNIT;
     th->angle = angle;
     th->flags = info->flags;
-    th->flags2 = (info->flags2 | ((M_Random() & 1) * MF2_MIRRORED));
+    th->flags2 = (info->flags2 | ((M_CosmeticRandom() & 1) * MF2_MIRRORED));
 
     th->state = st;
     th->tics = MAX(1, st->tics - (M_Random() & 3));
@@ -1216,11 +1216,11 @@ void P_SpawnSmokeTrail(fixed_t x, fixed_t y, fixed_t z, angle_t angle)
     mobj_t  *th = P_SpawnMobj(x, y, z + (M_SubRandom() << 10), MT_TRAIL);
 
     th->momz = FRACUNIT / 2;
-    th->tics -= M_Random() & 3;
+    th->tics -= M_CosmeticRandom() & 3;
 
     th->angle = angle;
 
-    th->flags2 |= (M_Random() & 1) * MF2_MIRRORED;
+    th->flags2 |= (M_CosmeticRandom() & 1) * MF2_MIRRORED;
 }
 
 //
@@ -1248,7 +1248,7 @@ void P_SpawnBlood(fixed_t x, fixed_t y, fixed_t z, angle_t angle, int damage, mo
         th->x = x;
         th->y = y;
         th->flags = info->flags;
-        th->flags2 = (info->flags2 | ((M_Random() & 1) * MF2_MIRRORED));
+        th->flags2 = (info->flags2 | ((M_CosmeticRandom() & 1) * MF2_MIRRORED));
 
         th->state = st;
         th->tics = MAX(1, st->tics - (M_Random() & 2));
@@ -1299,11 +1299,11 @@ void P_SpawnBloodSplat(fixed_t x, fixed_t y, int blood, int maxheight, mobj_t *t
 
         if (sec->terraintype == SOLID && sec->interpfloorheight <= maxheight && sec->floorpic != skyflatnum)
         {
-            bloodsplat_t    *splat = malloc(sizeof(*splat));
-            int             patch = firstbloodsplatlump + (M_Random() & 7);
+            bloodsplat_t    *splat = Z_Malloc(sizeof(*splat), PU_LEVEL, NULL);
+            int             patch = firstbloodsplatlump + (M_CosmeticRandom() & 7);
 
             splat->patch = patch;
-            splat->flip = M_Random() & 1;
+            splat->flip = M_CosmeticRandom() & 1;
             splat->colfunc = (blood == FUZZYBLOOD ? fuzzcolfunc : bloodsplatcolfunc);
             splat->blood = blood;
             splat->x = x;
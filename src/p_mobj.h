@@ -298,6 +298,9 @@ enum
     // Object is a map decoration
     MF2_DECORATION                = 0x10000000,
 
+    // Object has seen the player
+    MF2_SEENPLAYER                = 0x20000000,
+
     // Object is a missile from a monster
     MF2_MONSTERMISSILE            = 0x40000000,
 
@@ -431,6 +434,9 @@ typedef struct mobj_s
 
     int                 id;
     int                 musicid;
+
+    // [BH] number of times in a row the monster has thought less
+    int                 lazycount;
 } mobj_t;
 
 typedef struct bloodsplat_s
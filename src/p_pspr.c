@@ -672,9 +672,13 @@ void A_FireShotgun(mobj_t *actor, player_t *player, pspdef_t *psp)
 
     successfulshot = false;
 
+    P_StartTraceBatch(actor->x, actor->y);
+
     for (int i = 0; i < 7; i++)
         P_GunShot(actor, false);
 
+    P_EndTraceBatch();
+
     A_Recoil(wp_shotgun);
 
     player->shotsfired++;
@@ -706,10 +710,14 @@ void A_FireShotgun2(mobj_t *actor, player_t *player, pspdef_t *psp)
 
     successfulshot = false;
 
+    P_StartTraceBatch(actor->x, actor->y);
+
     for (int i = 0; i < 20; i++)
         P_LineAttack(actor, actor->angle + (M_SubRandom() << ANGLETOFINESHIFT), MISSILERANGE,
             bulletslope + (M_SubRandom() << 5), 5 * (M_Random() % 3 + 1));
 
+    P_EndTraceBatch();
+
     A_Recoil(wp_supershotgun);
 
     player->shotsfired++;
@@ -800,6 +808,8 @@ void A_BFGSpray(mobj_t *actor, player_t *player, pspdef_t *psp)
     if (mo->player)
         P_NoiseAlert(mo->player->mo);
 
+    P_StartTraceBatch(mo->target->x, mo->target->y);
+
     // offset angles from its attack angle
     for (int i = 0; i < 40; i++)
     {
@@ -823,6 +833,8 @@ void A_BFGSpray(mobj_t *actor, player_t *player, pspdef_t *psp)
         P_DamageMobj(linetarget, mo, mo, damage, true);
     }
 
+    P_EndTraceBatch();
+
     if (mo->player)
     {
         mo->player->shotsfired++;
@@ -910,8 +922,8 @@ void P_MovePsprites(void)
     {
         if (weapon->state == &states[S_BFG1])
         {
-            weapon->sx = M_RandomInt(-2, 2) * FRACUNIT;
-            weapon->sy = WEAPONTOP + M_RandomInt(-1, 1) * FRACUNIT;
+            weapon->sx = M_CosmeticRandomInt(-2, 2) * FRACUNIT;
+            weapon->sy = WEAPONTOP + M_CosmeticRandomInt(-1, 1) * FRACUNIT;
         }
         else if (weapon->state == &states[S_BFG2])
         {
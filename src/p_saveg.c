@@ -1069,11 +1069,15 @@ void P_UnArchiveWorld(void)
         soundtargets[MIN(i, TARGETLIMIT - 1)] = saveg_read32();
     }
 
+    // [BH] the sector heights have changed since P_SetupLevel() flushed the sight cache
+    P_FlushSightCache();
+
     // do lines
     for (int i = 0; i < numlines; i++, li++)
     {
         li->flags = saveg_read16();
         li->special = saveg_read16();
+        li->crossspecial = 0;
         li->tag = saveg_read16();
 
         for (int j = 0; j < 2; j++)
@@ -1213,7 +1217,7 @@ void P_UnArchiveThinkers(void)
 
             case tc_bloodsplat:
             {
-                bloodsplat_t    *splat = calloc(1, sizeof(*splat));
+                bloodsplat_t    *splat = Z_Calloc(1, sizeof(*splat), PU_LEVEL, NULL);
 
                 saveg_read_pad();
                 saveg_read_bloodsplat_t(splat);
@@ -1226,6 +1230,8 @@ void P_UnArchiveThinkers(void)
                     splat->colfunc = (splat->blood == FUZZYBLOOD ? fuzzcolfunc : bloodsplatcolfunc);
                     r_bloodsplats_total++;
                 }
+                else
+                    Z_Free(splat);
 
                 break;
             }
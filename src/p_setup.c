@@ -967,7 +967,7 @@ static void P_LoadZSegs(const byte *data)
 
 static void P_LoadZNodes(int lump)
 {
-    byte            *data = W_CacheLumpNum(lump);
+    byte            *data = W_LockLumpNum(lump);
     unsigned int    orgVerts;
     unsigned int    newVerts;
     unsigned int    numSubs;
@@ -1086,7 +1086,89 @@ static void P_LoadZNodes(int lump)
         }
     }
 
-    W_ReleaseLumpNum(lump);
+    W_UnlockLumpNum(lump);
+}
+
+//
+// P_SortNodes
+// [BH] Reorder the nodes so that every subtree of the BSP is stored
+//  contiguously, in the order it is walked by R_RenderBSPNode and
+//  P_CrossBSPNode, rather than in the order the node builder wrote them.
+//  The head node stays last. Maps with nodes that aren't all reachable
+//  from the head node exactly once are left as they are.
+//
+static void P_SortNodes(void)
+{
+    int         *order;
+    int         *stack;
+    node_t      *sorted;
+    int         count = 0;
+    int         top = 0;
+    dboolean    valid = true;
+
+    if (numnodes < 2)
+        return;
+
+    order = malloc(numnodes * sizeof(*order));
+    stack = malloc(numnodes * sizeof(*stack));
+
+    for (int i = 0; i < numnodes; i++)
+        order[i] = -1;
+
+    stack[top++] = numnodes - 1;
+
+    while (top && valid)
+    {
+        const int   i = stack[--top];
+        const int   *children = nodes[i].children;
+
+        if (order[i] != -1)
+        {
+            valid = false;
+            break;
+        }
+
+        order[i] = numnodes - 1 - count++;
+
+        // walk the front child's subtree first
+        for (int j = 1; j >= 0; j--)
+            if (!(children[j] & NF_SUBSECTOR))
+            {
+                if (children[j] >= numnodes || top == numnodes)
+                {
+                    valid = false;
+                    break;
+                }
+
+                stack[top++] = children[j];
+            }
+    }
+
+    free(stack);
+
+    if (!valid || count != numnodes)
+    {
+        free(order);
+        return;
+    }
+
+    sorted = malloc(numnodes * sizeof(*sorted));
+
+    for (int i = 0; i < numnodes; i++)
+    {
+        node_t  *node = &sorted[order[i]];
+
+        *node = nodes[i];
+
+        for (int j = 0; j < 2; j++)
+            if (!(node->children[j] & NF_SUBSECTOR))
+                node->children[j] = order[node->children[j]];
+    }
+
+    memcpy(nodes, sorted, numnodes * sizeof(*nodes));
+
+    free(sorted);
+    free(order);
 }
 
 //
@@ -1639,7 +1721,7 @@ static void P_CreateBlockMap(void)
                     while (bp->n);
 
                     blockmaplump[ndx++] = -1;                           // Store trailer
-                    free(bp->list);                                     // Free linedef list
+                    I_Free(bp->list);                                   // Free linedef list
                 }
                 else
                     // Empty blocklist: point to reserved empty blocklist
@@ -1744,7 +1826,7 @@ static void RejectOverrun(int lump, const byte **matrix)
         memset(newreject + length, 0, required - length);
 
         // unlock the original lump, it is no longer needed
-        W_ReleaseLumpNum(lump);
+        W_UnlockLumpNum(lump);
     }
 }
 
@@ -1755,10 +1837,10 @@ static void P_LoadReject(int lumpnum)
 {
     // dump any old cached reject lump, then cache the new one
     if (rejectlump != -1)
-        W_ReleaseLumpNum(rejectlump);
+        W_UnlockLumpNum(rejectlump);
 
     rejectlump = lumpnum + ML_REJECT;
-    rejectmatrix = W_CacheLumpNum(rejectlump);
+    rejectmatrix = W_LockLumpNum(rejectlump);
 
     // e6y: check for overflow
     RejectOverrun(rejectlump, &rejectmatrix);
@@ -1961,11 +2043,13 @@ static void P_CalcSegsLength(void)
     for (int i = 0; i < numsegs; i++)
     {
         seg_t   *li = segs + i;
+        int64_t length;
 
         li->dx = (int64_t)li->v2->x - li->v1->x;
         li->dy = (int64_t)li->v2->y - li->v1->y;
 
-        li->length = (int64_t)sqrt((double)li->dx * li->dx + (double)li->dy * li->dy) / 2;
+        length = (int64_t)sqrt((double)li->dx * li->dx + (double)li->dy * li->dy) / 2;
+        li->invlength = (length ? 1.0 / length : 0.0);
 
         // [BH] recalculate angle used for rendering. Fixes <https://doomwiki.org/wiki/Bad_seg_angle>.
         li->angle = R_PointToAngleEx2(li->v1->x, li->v1->y, li->v2->x, li->v2->y);
@@ -2195,11 +2279,14 @@ void P_SetupLevel(int ep, int map)
     idclev = false;
 
     Z_FreeTags(PU_LEVEL, PU_PURGELEVEL - 1);
+    Z_ResetLevelPeak();
+    P_FlushSightCache();
+    W_ClearLumpQueue(LOADER_LEVEL);
 
     if (rejectlump != -1)
     {
         // cph - unlock the reject table
-        W_ReleaseLumpNum(rejectlump);
+        W_UnlockLumpNum(rejectlump);
         rejectlump = -1;
     }
 
@@ -2249,8 +2336,8 @@ void P_SetupLevel(int ep, int map)
 
     leveltime = 0;
     animatedliquiddiff = FRACUNIT * 2;
-    animatedliquidxdir = M_RandomInt(-FRACUNIT / 12, FRACUNIT / 12);
-    animatedliquidydir = M_RandomInt(-FRACUNIT / 12, FRACUNIT / 12);
+    animatedliquidxdir = M_CosmeticRandomInt(-FRACUNIT / 12, FRACUNIT / 12);
+    animatedliquidydir = M_CosmeticRandomInt(-FRACUNIT / 12, FRACUNIT / 12);
 
     animatedliquidxoffs = 0;
     animatedliquidyoffs = 0;
@@ -2296,6 +2383,7 @@ void P_SetupLevel(int ep, int map)
         P_LoadSegs(lumpnum + ML_SEGS);
     }
 
+    P_SortNodes();
     P_GroupLines();
     P_LoadReject(lumpnum);
 
@@ -2697,6 +2785,34 @@ int P_GetMapTitlePatch(int map)
     return (MAPINFO >= 0 ? mapinfo[QualifyMap(map)].titlepatch : 0);
 }
 
+//
+// P_StartPrefetch
+// [BH] Called when the intermission starts, to queue the lumps of the next map so
+//  that they are read in while the stats are tallied, and are already cached by
+//  the time P_SetupLevel() loads the map.
+//
+void P_StartPrefetch(int ep, int map)
+{
+    char    lumpname[6];
+    int     lumpnum;
+
+    W_ClearLumpQueue(LOADER_LEVEL);
+
+    if (gamemode == commercial)
+        M_snprintf(lumpname, sizeof(lumpname), "MAP%02i", map);
+    else
+        M_snprintf(lumpname, sizeof(lumpname), "E%iM%i", ep, map);
+
+    if ((lumpnum = W_CheckNumForName(lumpname)) < 0)
+        return;
+
+    if (nerve && gamemission == doom2)
+        lumpnum = W_GetLastNumForName(lumpname);
+
+    for (int i = ML_THINGS; i <= ML_BLOCKMAP; i++)
+        W_QueueLump(lumpnum + i, LOADER_LEVEL);
+}
+
 //
 // P_Init
 //
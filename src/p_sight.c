@@ -59,6 +59,29 @@ typedef struct
 
 static los_t    los; // cph - made static
 
+// [BH] The results of sight checks that needed the BSP to be traversed are
+// kept for the rest of the tic, so that a blast or a monster checking the
+// same line of sight again doesn't traverse it again. Results are keyed on
+// the positions of both things, and are flushed whenever a floor or ceiling
+// moves and at the start of each tic.
+#define SIGHTCACHESIZE  512
+
+typedef struct
+{
+    int         stamp;
+    fixed_t     x1, y1, z1, height1;
+    fixed_t     x2, y2, z2, height2;
+    dboolean    result;
+} sightcache_t;
+
+static sightcache_t sightcache[SIGHTCACHESIZE];
+static int          sightstamp = 1;
+
+void P_FlushSightCache(void)
+{
+    sightstamp++;
+}
+
 //
 // P_DivlineSide
 // Returns side 0 (front), 1 (back), or 2 (on).
@@ -215,6 +238,7 @@ dboolean P_CheckSight(mobj_t *t1, mobj_t *t2)
     const sector_t  *s1 = t1->subsector->sector;
     const sector_t  *s2 = t2->subsector->sector;
     int             pnum = s1->id * numsectors + s2->id;
+    sightcache_t    *cached;
 
     // First check for trivial rejection.
     // Determine subsector entries in REJECT table.
@@ -236,6 +260,13 @@ dboolean P_CheckSight(mobj_t *t1, mobj_t *t2)
     if (t1->subsector == t2->subsector)
         return true;
 
+    cached = &sightcache[((unsigned int)(t1->x ^ t1->y * 3 ^ t2->x * 5 ^ t2->y * 7) >> FRACBITS) & (SIGHTCACHESIZE - 1)];
+
+    if (cached->stamp == sightstamp
+        && cached->x1 == t1->x && cached->y1 == t1->y && cached->z1 == t1->z && cached->height1 == t1->height
+        && cached->x2 == t2->x && cached->y2 == t2->y && cached->z2 == t2->z && cached->height2 == t2->height)
+        return cached->result;
+
     // An unobstructed LOS is possible.
     // Now look from eyes of t1 to any part of t2.
     validcount++;
@@ -274,5 +305,15 @@ dboolean P_CheckSight(mobj_t *t1, mobj_t *t2)
     }
 
     // the head node is the last node output
-    return P_CrossBSPNode(numnodes - 1);
+    cached->stamp = sightstamp;
+    cached->x1 = t1->x;
+    cached->y1 = t1->y;
+    cached->z1 = t1->z;
+    cached->height1 = t1->height;
+    cached->x2 = t2->x;
+    cached->y2 = t2->y;
+    cached->z2 = t2->z;
+    cached->height2 = t2->height;
+
+    return (cached->result = P_CrossBSPNode(numnodes - 1));
 }
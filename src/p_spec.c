@@ -72,6 +72,7 @@ typedef struct
     int             basepic;
     int             numpics;
     int             speed;
+    int             frame;          // [BH] leveltime / speed when last updated
 } anim_t;
 
 #if defined(_MSC_VER) || defined(__GNUC__)
@@ -1232,6 +1233,122 @@ dboolean P_CheckTag(line_t *line)
 // or shooting special lines, or by timed thinkers.
 //
 
+// [BH] flags for how crossing a line triggers its special
+#define CROSS_PLAYER    1       // the player can trigger it
+#define CROSS_MONSTER   2       // monsters can trigger it
+#define CROSS_ONCE      4       // the special is cleared once triggered
+#define CROSS_LOCKED    8       // the player needs a key
+
+//
+// P_DecodeCrossSpecial
+// [BH] Works out once who can trigger the line's special by crossing it,
+//  and for generalized linedef types, which function it calls, so that
+//  P_CrossSpecialLine doesn't need to work it out each time.
+//
+static void P_DecodeCrossSpecial(line_t *line)
+{
+    const int   special = line->special;
+    dboolean    (*linefunc)(line_t *line) = NULL;
+    dboolean    monsters = false;
+    int         flags = 0;
+
+    line->crossspecial = special;
+
+    // check each range of generalized linedefs
+    if (special >= GenFloorBase)
+    {
+        linefunc = EV_DoGenFloor;
+
+        // FloorModel is "Allow Monsters" if FloorChange is 0
+        monsters = (!(special & FloorChange) && (special & FloorModel));
+    }
+    else if (special >= GenCeilingBase)
+    {
+        linefunc = EV_DoGenCeiling;
+
+        // CeilingModel is "Allow Monsters" if CeilingChange is 0
+        monsters = (!(special & CeilingChange) && (special & CeilingModel));
+    }
+    else if (special >= GenDoorBase)
+    {
+        linefunc = EV_DoGenDoor;
+
+        // monsters can't open secret doors either
+        monsters = ((special & DoorMonster) && !(line->flags & ML_SECRET));
+    }
+    else if (special >= GenLockedBase)
+    {
+        // monsters disallowed from unlocking doors
+        linefunc = EV_DoGenLockedDoor;
+        flags = CROSS_LOCKED;
+    }
+    else if (special >= GenLiftBase)
+    {
+        linefunc = EV_DoGenLift;
+        monsters = !!(special & LiftMonster);
+    }
+    else if (special >= GenStairsBase)
+    {
+        linefunc = EV_DoGenStairs;
+        monsters = !!(special & StairMonster);
+    }
+    else if (special >= GenCrusherBase)
+    {
+        linefunc = EV_DoGenCrusher;
+        monsters = !!(special & CrusherMonster);
+    }
+
+    if (linefunc)
+    {
+        line->crossfunc = linefunc;
+
+        switch ((special & TriggerType) >> TriggerTypeShift)
+        {
+            case WalkOnce:
+                flags |= CROSS_ONCE;
+                break;
+
+            case WalkMany:
+                break;
+
+            default:                            // if not a walk type, do nothing here
+                line->crossflags = 0;
+                return;
+        }
+
+        line->crossflags = (flags | CROSS_PLAYER | (monsters ? CROSS_MONSTER : 0));
+        return;
+    }
+
+    line->crossfunc = NULL;
+    line->crossflags = CROSS_PLAYER;
+
+    switch (special)
+    {
+        case W1_Door_OpenWaitClose:
+        case W1_Lift_LowerWaitRaise:
+        case W1_Teleport:
+        case WR_Lift_LowerWaitRaise:
+        case WR_Teleport:
+        case W1_Teleport_MonstersOnly:
+        case WR_Teleport_MonstersOnly:
+        case W1_Teleport_AlsoMonsters_Silent_SameAngle:
+        case WR_Teleport_AlsoMonsters_Silent_SameAngle:
+        case W1_TeleportToLineWithSameTag_Silent_SameAngle:
+        case WR_TeleportToLineWithSameTag_Silent_SameAngle:
+        case W1_TeleportToLineWithSameTag_Silent_ReversedAngle:
+        case WR_TeleportToLineWithSameTag_Silent_ReversedAngle:
+        case W1_TeleportToLineWithSameTag_MonstersOnly_Silent_ReversedAngle:
+        case WR_TeleportToLineWithSameTag_MonstersOnly_Silent_ReversedAngle:
+        case W1_TeleportToLineWithSameTag_MonstersOnly_Silent:
+        case WR_TeleportToLineWithSameTag_MonstersOnly_Silent:
+        case W1_Teleport_MonstersOnly_Silent:
+        case WR_Teleport_MonstersOnly_Silent:
+            line->crossflags |= CROSS_MONSTER;
+            break;
+    }
+}
+
 //
 // P_CrossSpecialLine - TRIGGER
 // Called every time a thing origin is about
@@ -1266,133 +1383,24 @@ void P_CrossSpecialLine(line_t *line, int side, mobj_t *thing)
             return;
     }
 
-    // jff 02/04/98 add check here for generalized linedef types
-    {
-        // pointer to line function is NULL by default, set non-NULL if
-        // line special is walkover generalized linedef type
-        dboolean (*linefunc)(line_t *line) = NULL;
-
-        // check each range of generalized linedefs
-        if (line->special >= GenFloorBase)
-        {
-            if (!thing->player)
-                if ((line->special & FloorChange) || !(line->special & FloorModel))
-                    return;                     // FloorModel is "Allow Monsters" if FloorChange is 0
-
-            linefunc = EV_DoGenFloor;
-        }
-        else if (line->special >= GenCeilingBase)
-        {
-            if (!thing->player)
-                if ((line->special & CeilingChange) || !(line->special & CeilingModel))
-                    return;                     // CeilingModel is "Allow Monsters" if CeilingChange is 0
-
-            linefunc = EV_DoGenCeiling;
-        }
-        else if (line->special >= GenDoorBase)
-        {
-            if (!thing->player)
-            {
-                if (!(line->special & DoorMonster))
-                    return;                     // monsters disallowed from this door
-
-                if (line->flags & ML_SECRET)    // they can't open secret doors either
-                    return;
-            }
-
-            linefunc = EV_DoGenDoor;
-        }
-        else if (line->special >= GenLockedBase)
-        {
-            if (!thing->player)
-                return;                         // monsters disallowed from unlocking doors
-
-            if ((line->special & TriggerType) == WalkOnce || (line->special & TriggerType) == WalkMany)
-            {
-                // jff 4/1/98 check for being a walk type before reporting door type
-                if (!P_CanUnlockGenDoor(line))
-                    return;
-            }
-            else
-                return;
-
-            linefunc = EV_DoGenLockedDoor;
-        }
-        else if (line->special >= GenLiftBase)
-        {
-            if (!thing->player)
-                if (!(line->special & LiftMonster))
-                    return;                     // monsters disallowed
-
-            linefunc = EV_DoGenLift;
-        }
-        else if (line->special >= GenStairsBase)
-        {
-            if (!thing->player)
-                if (!(line->special & StairMonster))
-                    return;                     // monsters disallowed
+    // [BH] decode how the line's special is triggered if it has changed
+    if (line->crossspecial != line->special)
+        P_DecodeCrossSpecial(line);
 
-            linefunc = EV_DoGenStairs;
-        }
-        else if (line->special >= GenCrusherBase)
-        {
-            if (!thing->player)
-                if (!(line->special & CrusherMonster))
-                    return;                     // monsters disallowed
-
-            linefunc = EV_DoGenCrusher;
-        }
-
-        // if it was a valid generalized type
-        if (linefunc)
-            switch ((line->special & TriggerType) >> TriggerTypeShift)
-            {
-                case WalkOnce:
-                    if (linefunc(line))
-                        line->special = 0;      // clear special if a walk once type
-
-                    return;
-
-                case WalkMany:
-                    linefunc(line);
-                    return;
-
-                default:                        // if not a walk type, do nothing here
-                    return;
-            }
-    }
+    if (!(line->crossflags & (thing->player ? CROSS_PLAYER : CROSS_MONSTER)))
+        return;
 
-    if (!thing->player)
+    // jff 02/04/98 add check here for generalized linedef types
+    if (line->crossfunc)
     {
-        dboolean    okay = false;
+        // jff 4/1/98 check for being a walk type before reporting door type
+        if ((line->crossflags & CROSS_LOCKED) && !P_CanUnlockGenDoor(line))
+            return;
 
-        switch (line->special)
-        {
-            case W1_Door_OpenWaitClose:
-            case W1_Lift_LowerWaitRaise:
-            case W1_Teleport:
-            case WR_Lift_LowerWaitRaise:
-            case WR_Teleport:
-            case W1_Teleport_MonstersOnly:
-            case WR_Teleport_MonstersOnly:
-            case W1_Teleport_AlsoMonsters_Silent_SameAngle:
-            case WR_Teleport_AlsoMonsters_Silent_SameAngle:
-            case W1_TeleportToLineWithSameTag_Silent_SameAngle:
-            case WR_TeleportToLineWithSameTag_Silent_SameAngle:
-            case W1_TeleportToLineWithSameTag_Silent_ReversedAngle:
-            case WR_TeleportToLineWithSameTag_Silent_ReversedAngle:
-            case W1_TeleportToLineWithSameTag_MonstersOnly_Silent_ReversedAngle:
-            case WR_TeleportToLineWithSameTag_MonstersOnly_Silent_ReversedAngle:
-            case W1_TeleportToLineWithSameTag_MonstersOnly_Silent:
-            case WR_TeleportToLineWithSameTag_MonstersOnly_Silent:
-            case W1_Teleport_MonstersOnly_Silent:
-            case WR_Teleport_MonstersOnly_Silent:
-                okay = true;
-                break;
-        }
+        if (line->crossfunc(line) && (line->crossflags & CROSS_ONCE))
+            line->special = 0;                  // clear special if a walk once type
 
-        if (!okay)
-            return;
+        return;
     }
 
     if (!P_CheckTag(line))                      // jff 2/27/98 disallow zero tag on some types
@@ -2299,16 +2307,26 @@ void P_UpdateSpecials(void)
             G_ExitLevel();
 
     // ANIMATE FLATS AND TEXTURES GLOBALLY
+    // [BH] only when an animation moves on to its next frame
     for (anim_t *anim = anims; anim < lastanim; anim++)
+    {
+        int frame = leveltime / anim->speed;
+
+        if (frame == anim->frame)
+            continue;
+
+        anim->frame = frame;
+
         for (int i = anim->basepic; i < anim->basepic + anim->numpics; i++)
         {
-            int pic = anim->basepic + ((leveltime / anim->speed + i) % anim->numpics);
+            int pic = anim->basepic + ((frame + i) % anim->numpics);
 
             if (anim->istexture)
                 texturetranslation[i] = pic;
             else
                 flattranslation[i] = firstflat + pic;
         }
+    }
 
     animatedliquiddiff += animatedliquiddiffs[leveltime & 63];
     animatedliquidxoffs += animatedliquidxdir;
@@ -2324,6 +2342,9 @@ void P_UpdateSpecials(void)
     skycolumnoffset += skyscrolldelta;
 
     // DO BUTTONS
+    if (!activebuttons)
+        return;
+
     for (int i = 0; i < maxbuttons; i++)
         if (buttonlist[i].btimer)
             if (!--buttonlist[i].btimer)
@@ -2377,6 +2398,8 @@ void P_UpdateSpecials(void)
 
                 if (!sector || (!sector->floordata && !sector->ceilingdata) || line->tag != sector->tag)
                     S_StartSectorSound(buttonlist[i].soundorg, sfx_swtchn);
+
+                activebuttons--;
             }
 }
 
@@ -2548,6 +2571,12 @@ void P_SpawnSpecials(void)
     for (int i = 0; i < maxbuttons; i++)
         memset(&buttonlist[i], 0, sizeof(button_t));
 
+    activebuttons = 0;
+
+    // [BH] make sure all animations are updated on the first tic
+    for (anim_t *anim = anims; anim < lastanim; anim++)
+        anim->frame = -1;
+
     // P_InitTagLists() must be called before P_FindSectorFromLineTag()
     // or P_FindLineFromLineTag() can be called.
 
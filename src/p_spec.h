@@ -229,6 +229,7 @@ typedef struct
 
 extern button_t *buttonlist;
 extern int      maxbuttons;
+extern int      activebuttons;
 
 void P_ChangeSwitchTexture(line_t *line, dboolean useagain);
 
@@ -53,6 +53,7 @@ static int          numswitches;        // killough
 
 button_t            *buttonlist = NULL;
 int                 maxbuttons = MAXBUTTONS;
+int                 activebuttons;
 
 extern texture_t    **textures;
 extern dboolean     autousing;
@@ -154,6 +155,10 @@ void P_StartButton(line_t *line, bwhere_e where, int texture, int time)
             buttonlist[i].btexture = texture;
             buttonlist[i].btimer = time;
             buttonlist[i].soundorg = &line->soundorg;
+
+            if (time)
+                activebuttons++;
+
             return;
         }
 
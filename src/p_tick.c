@@ -179,6 +179,8 @@ void P_Ticker(void)
     if (paused)
         return;
 
+    P_FlushSightCache();
+
     P_PlayerThink();
 
     if (menuactive || consoleactive)
@@ -66,8 +66,104 @@ void R_ClearDrawSegs(void)
 // CPhipps -
 // Instead of clipsegs, let's try using an array with one entry for each column,
 // indicating whether it's blocked by a solid wall yet or not.
-static int  memcmpsize;
-byte        *solidcol;
+// [BH] Each column is now a single bit, so 64 columns can be tested at once, and
+//  solidcolumns counts how many columns are blocked so a full screen is caught
+//  without scanning at all.
+#define SOLIDCOLBITS    64
+
+static int      memcmpsize;
+static uint64_t *solidcol;
+static int      solidcolumns;
+
+static int R_CountTrailingZeros(uint64_t word)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    int count = 0;
+
+    while (!(word & 1))
+    {
+        word >>= 1;
+        count++;
+    }
+
+    return count;
+#endif
+}
+
+static int R_CountBits(uint64_t word)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+
+    for (; word; count++)
+        word &= word - 1;
+
+    return count;
+#endif
+}
+
+//
+// R_FindColumn
+// [BH] Returns the first column from first up to, but not including, last that is
+//  solid (or open if solid is false), or last if there isn't one.
+//
+static int R_FindColumn(int first, const int last, const dboolean solid)
+{
+    while (first < last)
+    {
+        uint64_t    word = solidcol[first / SOLIDCOLBITS];
+        const int   base = first & ~(SOLIDCOLBITS - 1);
+
+        if (!solid)
+            word = ~word;
+
+        if ((word &= ~0ULL << (first - base)))
+            return MIN(base + R_CountTrailingZeros(word), last);
+
+        first = base + SOLIDCOLBITS;
+    }
+
+    return last;
+}
+
+//
+// R_SetSolidColumns
+// [BH] Marks columns from first up to, but not including, last as solid.
+//
+static void R_SetSolidColumns(int first, const int last)
+{
+    while (first < last)
+    {
+        uint64_t    *word = &solidcol[first / SOLIDCOLBITS];
+        const int   bit = first & (SOLIDCOLBITS - 1);
+        const int   count = MIN(SOLIDCOLBITS - bit, last - first);
+        uint64_t    mask = (count == SOLIDCOLBITS ? ~0ULL : ((1ULL << count) - 1) << bit);
+
+        if ((mask &= ~*word))
+        {
+            *word |= mask;
+            solidcolumns += R_CountBits(mask);
+        }
+
+        first += count;
+    }
+}
+
+void R_SetSolidColumn(const int x)
+{
+    uint64_t        *word = &solidcol[x / SOLIDCOLBITS];
+    const uint64_t  mask = 1ULL << (x & (SOLIDCOLBITS - 1));
+
+    if (!(*word & mask))
+    {
+        *word |= mask;
+        solidcolumns++;
+    }
+}
 
 // CPhipps -
 // R_ClipWallSegment
@@ -76,28 +172,17 @@ byte        *solidcol;
 // columns which aren't solid, and updates the solidcol[] array appropriately
 static void R_ClipWallSegment(int first, int last, dboolean solid)
 {
-    while (first < last)
-        if (solidcol[first])
-        {
-            byte    *p = memchr(solidcol + first, 0, (size_t)last - first);
-
-            if (!p)
-                return;
-
-            first = (int)(p - solidcol);
-        }
-        else
-        {
-            byte    *p = memchr(solidcol + first, 1, (size_t)last - first);
-            int     to = (p ? (int)(p - solidcol) : last);
+    while ((first = R_FindColumn(first, last, false)) < last)
+    {
+        const int   to = R_FindColumn(first, last, true);
 
-            R_StoreWallRange(first, to - 1);
+        R_StoreWallRange(first, to - 1);
 
-            if (solid)
-                memset(solidcol + first, 1, (size_t)to - first);
+        if (solid)
+            R_SetSolidColumns(first, to);
 
-            first = to;
-        }
+        first = to;
+    }
 }
 
 //
@@ -110,7 +195,7 @@ void R_InitClipSegs(void)
         + sizeof(*frontsector->floorlightsec) + sizeof(*frontsector->ceilinglightsec)
         + sizeof(frontsector->floorpic) + sizeof(frontsector->ceilingpic)
         + sizeof(frontsector->lightlevel);
-    solidcol = calloc(1, SCREENWIDTH * sizeof(*solidcol));
+    solidcol = calloc((SCREENWIDTH + SOLIDCOLBITS - 1) / SOLIDCOLBITS, sizeof(*solidcol));
 }
 
 //
@@ -118,7 +203,8 @@ void R_InitClipSegs(void)
 //
 void R_ClearClipSegs(void)
 {
-    memset(solidcol, 0, SCREENWIDTH);
+    memset(solidcol, 0, (SCREENWIDTH + SOLIDCOLBITS - 1) / SOLIDCOLBITS * sizeof(*solidcol));
+    solidcolumns = 0;
 }
 
 // killough 1/18/98 -- This function is used to fix the automap bug which
@@ -452,6 +538,10 @@ static dboolean R_CheckBBox(const fixed_t *bspcoord)
     if (boxpos == 5)
         return true;
 
+    // [BH] nothing more can be seen once every column is solid
+    if (solidcolumns >= viewwidth)
+        return false;
+
     check = checkcoord[boxpos];
 
     // check clip list for an open space
@@ -492,7 +582,7 @@ static dboolean R_CheckBBox(const fixed_t *bspcoord)
     if (sx1 == sx2)
         return false;
 
-    if (!memchr(solidcol + sx1, 0, (size_t)sx2 - sx1))
+    if (R_FindColumn(sx1, sx2, false) == sx2)
         return false;
 
     return true;
@@ -564,6 +654,49 @@ static void R_Subsector(int num)
         R_AddLine(line++);
 }
 
+//
+// R_MapSubsector
+// [BH] Marks the lines of a subsector that can be seen for the automap,
+//  without finding its planes or adding its sprites.
+//
+static void R_MapSubsector(int num)
+{
+    subsector_t *sub = subsectors + num;
+    sector_t    tempsec;
+    int         count = sub->numlines;
+    seg_t       *line = segs + sub->firstline;
+
+    frontsector = sub->sector;
+    R_MaybeInterpolateSector(frontsector);
+    frontsector = R_FakeFlat(frontsector, &tempsec, NULL, NULL, false);
+
+    while (count--)
+        R_AddLine(line++);
+}
+
+//
+// R_MapBSPNode
+// [BH] Walks the BSP like R_RenderBSPNode, but only to mark the lines that
+//  can be seen while the automap is open.
+//
+void R_MapBSPNode(int bspnum)
+{
+    while (!(bspnum & NF_SUBSECTOR))
+    {
+        const node_t    *bsp = nodes + bspnum;
+        int             side = R_PointOnSide(viewx, viewy, bsp);
+
+        R_MapBSPNode(bsp->children[side]);
+
+        if (!R_CheckBBox(bsp->bbox[(side ^= 1)]))
+            return;
+
+        bspnum = bsp->children[side];
+    }
+
+    R_MapSubsector(bspnum == -1 ? 0 : (bspnum & ~NF_SUBSECTOR));
+}
+
 //
 // RenderBSPNode
 // Renders all subsectors below a given node,
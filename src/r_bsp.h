@@ -46,16 +46,16 @@ extern sector_t     *backsector;
 
 extern drawseg_t    *drawsegs;
 
-extern byte         *solidcol;
-
 extern drawseg_t    *ds_p;
 
 // BSP?
 void R_InitClipSegs(void);
 void R_ClearClipSegs(void);
+void R_SetSolidColumn(const int x);
 void R_ClearDrawSegs(void);
 
 void R_RenderBSPNode(int bspnum);
+void R_MapBSPNode(int bspnum);
 
 // killough 4/13/98: fake floors/ceilings for deep water/fake ceilings:
 sector_t *R_FakeFlat(sector_t *sec, sector_t *tempsec, int *floorlightlevel, int *ceilinglightlevel, dboolean back);
@@ -611,12 +611,12 @@ static void R_InitColormaps(void)
         colormaps = Z_Malloc(sizeof(*colormaps) * numcolormaps, PU_STATIC, NULL);
 
         for (int i = 1; i < numcolormaps; i++)
-            colormaps[i] = W_CacheLumpNum(i + firstcolormaplump);
+            colormaps[i] = W_LockLumpNum(i + firstcolormaplump);
     }
     else
         colormaps = Z_Malloc(sizeof(*colormaps), PU_STATIC, NULL);
 
-    dc_colormap[1] = colormaps[0] = W_CacheLumpName("COLORMAP");
+    dc_colormap[1] = colormaps[0] = W_LockLumpName("COLORMAP");
 
     colormapwad = lumpinfo[W_CheckNumForName("COLORMAP")]->wadfile;
 
@@ -288,6 +288,12 @@ typedef struct line_s
     int                 nexttag;
     int                 firsttag;
 
+    // [BH] how crossing the line triggers its special, decoded from
+    //  crossspecial the first time the line is crossed with that special
+    unsigned short      crossspecial;
+    byte                crossflags;
+    dboolean            (*crossfunc)(struct line_s *line);
+
     int                 r_validcount;   // cph: if == gametime, r_flags already done
 
     enum
@@ -794,7 +800,9 @@ typedef struct
 
     int64_t             dx, dy;
 
-    int64_t             length;
+    // [BH] reciprocal of the seg's length, so R_StoreWallRange can multiply
+    //  rather than divide
+    double              invlength;
 
     side_t              *sidedef;
     line_t              *linedef;
@@ -940,6 +948,10 @@ typedef struct
     sector_t            *heightsec;
 
     int                 shadowpos;
+
+    // [BH] clipping arrays, indexed from x1 to x2
+    int                 *cliptop;
+    int                 *clipbot;
 } vissprite_t;
 
 typedef struct
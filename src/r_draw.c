@@ -226,7 +226,7 @@ void R_DrawFuzzyShadowColumn(void)
     int     y = dc_yh - dc_yl + 1;
     byte    *dest = ylookup0[dc_yl] + dc_x;
 
-    if (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_Random() & 3)))
+    if (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_RenderRandom(&fuzzseed) & 3)))
         *dest = *(*dest + dc_black25);
 
     dest += SCREENWIDTH;
@@ -237,7 +237,7 @@ void R_DrawFuzzyShadowColumn(void)
         dest += SCREENWIDTH;
     }
 
-    if (dc_yh < dc_floorclip && (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_Random() & 3))))
+    if (dc_yh < dc_floorclip && (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_RenderRandom(&fuzzseed) & 3))))
         *dest = *(*dest + dc_black25);
 }
 
@@ -260,7 +260,7 @@ void R_DrawSolidFuzzyShadowColumn(void)
     int     y = dc_yh - dc_yl + 1;
     byte    *dest = ylookup0[dc_yl] + dc_x;
 
-    if (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_Random() & 3)))
+    if (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_RenderRandom(&fuzzseed) & 3)))
         *dest = dc_black;
 
     dest += SCREENWIDTH;
@@ -271,7 +271,7 @@ void R_DrawSolidFuzzyShadowColumn(void)
         dest += SCREENWIDTH;
     }
 
-    if (dc_yh < dc_floorclip && (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_Random() & 3))))
+    if (dc_yh < dc_floorclip && (((consoleactive || freeze) && !fuzztable[fuzzpos++]) || (!consoleactive && !freeze && !(M_RenderRandom(&fuzzseed) & 3))))
         *dest = dc_black;
 }
 
@@ -449,10 +449,14 @@ void R_DrawTranslucentSuperShotgunColumn(void)
     *dest = tinttabredwhite1[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
 }
 
-void R_DrawSkyColumn(void)
+//
+// [BH] The sky is drawn either straight to the screen, or into a buffer that
+//  is viewheight pixels high so it can be copied to the screen by
+//  R_DrawSkyColumnFromBuffer each time that column of the sky is visible.
+//
+static void R_DrawSkyColumnTo(byte *dest, const int pitch)
 {
     int                 y = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
     const lighttable_t  *colormap = dc_colormap[0];
 
@@ -461,7 +465,7 @@ void R_DrawSkyColumn(void)
         while (y--)
         {
             *dest = colormap[dc_source[(frac & ((127 << FRACBITS) | 0xFFFF)) >> FRACBITS]];
-            dest += SCREENWIDTH;
+            dest += pitch;
             frac += dc_iscale;
         }
     }
@@ -476,10 +480,10 @@ void R_DrawSkyColumn(void)
             while ((y -= 2) >= 0)
             {
                 *dest = colormap[dc_source[(frac & heightmask) >> FRACBITS]];
-                dest += SCREENWIDTH;
+                dest += pitch;
                 frac += dc_iscale;
                 *dest = colormap[dc_source[(frac & heightmask) >> FRACBITS]];
-                dest += SCREENWIDTH;
+                dest += pitch;
                 frac += dc_iscale;
             }
 
@@ -499,7 +503,7 @@ void R_DrawSkyColumn(void)
             while (y--)
             {
                 *dest = colormap[dc_source[frac >> FRACBITS]];
-                dest += SCREENWIDTH;
+                dest += pitch;
 
                 if ((frac += dc_iscale) >= heightmask)
                     frac -= heightmask;
@@ -508,10 +512,9 @@ void R_DrawSkyColumn(void)
     }
 }
 
-void R_DrawFlippedSkyColumn(void)
+static void R_DrawFlippedSkyColumnTo(byte *dest, const int pitch)
 {
     int                 y = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
     const lighttable_t  *colormap = dc_colormap[0];
     fixed_t             i;
@@ -519,13 +522,49 @@ void R_DrawFlippedSkyColumn(void)
     while (--y)
     {
         *dest = colormap[dc_source[(i = frac >> FRACBITS) < 128 ? i : 126 - (i & 127)]];
-        dest += SCREENWIDTH;
+        dest += pitch;
         frac += dc_iscale;
     }
 
     *dest = colormap[dc_source[(i = frac >> FRACBITS) < 128 ? i : 126 - (i & 127)]];
 }
 
+void R_DrawSkyColumn(void)
+{
+    R_DrawSkyColumnTo(ylookup0[dc_yl] + dc_x, SCREENWIDTH);
+}
+
+void R_DrawFlippedSkyColumn(void)
+{
+    R_DrawFlippedSkyColumnTo(ylookup0[dc_yl] + dc_x, SCREENWIDTH);
+}
+
+void R_DrawSkyColumnToBuffer(byte *buffer)
+{
+    R_DrawSkyColumnTo(buffer + dc_yl, 1);
+}
+
+void R_DrawFlippedSkyColumnToBuffer(byte *buffer)
+{
+    R_DrawFlippedSkyColumnTo(buffer + dc_yl, 1);
+}
+
+void R_DrawSkyColumnFromBuffer(const byte *buffer)
+{
+    int     y = dc_yh - dc_yl + 1;
+    byte    *dest = ylookup0[dc_yl] + dc_x;
+
+    buffer += dc_yl;
+
+    while (--y)
+    {
+        *dest = *buffer++;
+        dest += SCREENWIDTH;
+    }
+
+    *dest = *buffer;
+}
+
 void R_DrawSkyColorColumn(void)
 {
     int         y = dc_yh - dc_yl + 1;
@@ -916,6 +955,10 @@ void R_DrawTranslucentBlue25Column(void)
 
 const int       fuzzrange[3] = { -SCREENWIDTH, 0, SCREENWIDTH };
 
+// [BH] Seed for the random fuzz drawn by the thread doing the drawing, kept
+//  apart from the seed used by gameplay.
+unsigned int    fuzzseed;
+
 void R_DrawFuzzColumn(void)
 {
     byte    *dest = ylookup0[dc_yl] + dc_x;
@@ -927,7 +970,7 @@ void R_DrawFuzzColumn(void)
     // top
     if (!dc_yl)
         *dest = fullcolormap[6 * 256 + dest[(fuzztable[fuzzpos++] = FUZZ(0, 1))]];
-    else if (!(M_Random() & 3))
+    else if (!(M_RenderRandom(&fuzzseed) & 3))
         *dest = fullcolormap[12 * 256 + dest[(fuzztable[fuzzpos++] = FUZZ(-1, 1))]];
 
     dest += SCREENWIDTH;
@@ -942,7 +985,7 @@ void R_DrawFuzzColumn(void)
     // bottom
     *dest = fullcolormap[5 * 256 + dest[(fuzztable[fuzzpos++] = FUZZ(-1, 0))]];
 
-    if (dc_yh < dc_floorclip && !(M_Random() & 3))
+    if (dc_yh < dc_floorclip && !(M_RenderRandom(&fuzzseed) & 3))
     {
         dest += SCREENWIDTH;
         *dest = fullcolormap[14 * 256 + dest[(fuzztable[fuzzpos] = FUZZ(-1, 0))]];
@@ -1008,7 +1051,7 @@ void R_DrawFuzzColumns(void)
                 if (!y || *(src - SCREENWIDTH) == NOFUZZ)
                 {
                     // top
-                    if (!(M_Random() & 3))
+                    if (!(M_RenderRandom(&fuzzseed) & 3))
                         *dest = fullcolormap[12 * 256 + dest[(fuzztable[i] = FUZZ(-1, 1))]];
                 }
                 else if (y == h - SCREENWIDTH)
@@ -1019,7 +1062,7 @@ void R_DrawFuzzColumns(void)
                 else if (*(src + SCREENWIDTH) == NOFUZZ)
                 {
                     // bottom of post
-                    if (!(M_Random() & 3))
+                    if (!(M_RenderRandom(&fuzzseed) & 3))
                         *dest = fullcolormap[12 * 256 + dest[(fuzztable[i] = FUZZ(-1, 1))]];
                 }
                 else
@@ -1027,7 +1070,7 @@ void R_DrawFuzzColumns(void)
                     // middle
                     if (*(src - 1) == NOFUZZ || *(src + 1) == NOFUZZ)
                     {
-                        if (!(M_Random() & 3))
+                        if (!(M_RenderRandom(&fuzzseed) & 3))
                             *dest = fullcolormap[12 * 256 + dest[(fuzztable[i] = FUZZ(-1, 1))]];
                     }
                     else
@@ -1186,6 +1229,26 @@ void R_DrawSpan(void)
     *dest = ds_colormap[ds_source[((xfrac >> 16) & 63) | ((yfrac >> 10) & 4032)]];
 }
 
+//
+// [BH] Draws a span from a flat that already has its colormap applied.
+//
+void R_DrawLitSpan(void)
+{
+    int     x = ds_x2 - ds_x1;
+    byte    *dest = ylookup0[ds_y] + ds_x1;
+    fixed_t xfrac = ds_xfrac;
+    fixed_t yfrac = ds_yfrac;
+
+    while (--x)
+    {
+        *dest++ = ds_source[((xfrac >> 16) & 63) | ((yfrac >> 10) & 4032)];
+        xfrac += ds_xstep;
+        yfrac += ds_ystep;
+    }
+
+    *dest = ds_source[((xfrac >> 16) & 63) | ((yfrac >> 10) & 4032)];
+}
+
 void R_DrawColorSpan(void)
 {
     int         x = ds_x2 - ds_x1;
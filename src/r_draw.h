@@ -39,7 +39,7 @@
 #if !defined(__R_DRAW_H__)
 #define __R_DRAW_H__
 
-#define FUZZ(a, b)      fuzzrange[M_RandomInt(a, b) + 1]
+#define FUZZ(a, b)      fuzzrange[M_RenderRandomInt(&fuzzseed, a, b) + 1]
 
 // [BH] Compensate for rounding errors in DOOM's renderer by stretching wall
 //  columns by 1px. This eliminates the randomly-colored pixels ("sparkles")
@@ -71,6 +71,7 @@ extern byte             *dc_source;
 
 extern const int        fuzzrange[3];
 extern int              fuzztable[SCREENWIDTH * SCREENHEIGHT];
+extern unsigned int     fuzzseed;
 
 // The span blitting interface.
 // Hook in assembler or system specific BLT here.
@@ -81,6 +82,9 @@ void R_DrawBrightMapWallColumn(void);
 void R_DrawSkyColumn(void);
 void R_DrawFlippedSkyColumn(void);
 void R_DrawSkyColorColumn(void);
+void R_DrawSkyColumnToBuffer(byte *buffer);
+void R_DrawFlippedSkyColumnToBuffer(byte *buffer);
+void R_DrawSkyColumnFromBuffer(const byte *buffer);
 void R_DrawTranslucentColumn(void);
 void R_DrawTranslucent50Column(void);
 void R_DrawTranslucentColor50Column(void);
@@ -145,6 +149,7 @@ extern byte         *dc_translation;
 // Span blitting for rows, floor/ceiling.
 // No Spectre effect needed.
 void R_DrawSpan(void);
+void R_DrawLitSpan(void);
 void R_DrawColorSpan(void);
 
 void R_InitBuffer(int width, int height);
@@ -36,6 +36,8 @@
 ========================================================================
 */
 
+#include <string.h>
+
 #include "c_console.h"
 #include "doomstat.h"
 #include "i_colors.h"
@@ -104,15 +106,19 @@ angle_t             tantoangle[SLOPERANGE + 1];
 // killough 3/20/98: Support dynamic colormaps, e.g. deep water
 // killough 4/4/98: support dynamic number of them as well
 int                 numcolormaps = 1;
-static lighttable_t *(*c_scalelight)[LIGHTLEVELS][MAXLIGHTSCALE];
-static lighttable_t *(*c_zlight)[LIGHTLEVELS][MAXLIGHTZ];
-static lighttable_t *(*c_psprscalelight)[OLDLIGHTLEVELS][OLDMAXLIGHTSCALE];
-lighttable_t        *(*scalelight)[MAXLIGHTSCALE];
-lighttable_t        *(*psprscalelight)[OLDMAXLIGHTSCALE];
-lighttable_t        *(*zlight)[MAXLIGHTZ];
 lighttable_t        *fullcolormap;
 lighttable_t        **colormaps;
 
+// [BH] Light ramps hold offsets into fullcolormap rather than pointers into
+//  each colormap, so they are shared by all colormaps and small enough to stay
+//  in cache. Ramps are only built for those light levels that are drawn.
+static lightoffset_t    scalelight[LIGHTLEVELS][MAXLIGHTSCALE];
+static lightoffset_t    zlight[LIGHTLEVELS][MAXLIGHTZ];
+static dboolean         scalelightbuilt[LIGHTLEVELS];
+static dboolean         zlightbuilt[LIGHTLEVELS];
+static int              zlightwidth;
+lightoffset_t           psprscalelight[OLDLIGHTLEVELS][OLDMAXLIGHTSCALE];
+
 // bumped light from gun blasts
 int                 extralight;
 
@@ -133,7 +139,6 @@ extern dboolean     canmouselook;
 extern int          barrelms;
 extern dboolean     transferredsky;
 extern dboolean     vanilla;
-extern lighttable_t **walllights;
 
 //
 // R_PointOnSide
@@ -357,35 +362,63 @@ static void R_InitTextureMapping(void)
 
 //
 // R_InitLightTables
-// Only inits the zlight table,
+// Only resets the zlight table,
 //  because the scalelight table changes with view size.
 //
 #define DISTMAP 2
 
 void R_InitLightTables(void)
 {
-    int width = FixedMul(SCREENWIDTH, FixedDiv(FRACUNIT, finetangent[FINEANGLES / 4 + (r_fov * FINEANGLES / 360) / 2])) + 1;
+    zlightwidth = FixedMul(SCREENWIDTH, FixedDiv(FRACUNIT, finetangent[FINEANGLES / 4 + (r_fov * FINEANGLES / 360) / 2])) + 1;
+    memset(zlightbuilt, false, sizeof(zlightbuilt));
+}
 
-    c_zlight = malloc(sizeof(*c_zlight) * numcolormaps);
-    c_scalelight = malloc(sizeof(*c_scalelight) * numcolormaps);
-    c_psprscalelight = malloc(sizeof(*c_psprscalelight) * numcolormaps);
+//
+// R_ScaleLight
+// Returns the light ramp to use for each scale at the given light level,
+//  calculating it the first time that light level is used.
+//
+const lightoffset_t *R_ScaleLight(const int level)
+{
+    lightoffset_t   *ramp = scalelight[level];
 
-    // Calculate the light levels to use
-    //  for each level / distance combination.
-    for (int i = 0; i < LIGHTLEVELS; i++)
+    if (!scalelightbuilt[level])
     {
-        const int   start = ((LIGHTLEVELS - LIGHTBRIGHT - i) * 2) * NUMCOLORMAPS / LIGHTLEVELS;
+        const int   start = ((LIGHTLEVELS - LIGHTBRIGHT - level) * 2) * NUMCOLORMAPS / LIGHTLEVELS;
+
+        for (int j = 0; j < MAXLIGHTSCALE; j++)
+            ramp[j] = BETWEEN(0, start - j * SCREENWIDTH / (viewwidth * DISTMAP), NUMCOLORMAPS - 1) * 256;
+
+        scalelightbuilt[level] = true;
+    }
+
+    return ramp;
+}
+
+//
+// R_ZLight
+// Returns the light ramp to use for each distance at the given light level,
+//  calculating it the first time that light level is used.
+//
+const lightoffset_t *R_ZLight(const int level)
+{
+    lightoffset_t   *ramp = zlight[level];
+
+    if (!zlightbuilt[level])
+    {
+        const int   start = ((LIGHTLEVELS - LIGHTBRIGHT - level) * 2) * NUMCOLORMAPS / LIGHTLEVELS;
 
         for (int j = 0; j < MAXLIGHTZ; j++)
         {
-            const int   scale = FixedDiv(width / 2 * FRACUNIT, (j + 1) << LIGHTZSHIFT) >> LIGHTSCALESHIFT;
-            const int   level = BETWEEN(0, start - scale / DISTMAP, NUMCOLORMAPS - 1) * 256;
+            const int   scale = FixedDiv(zlightwidth / 2 * FRACUNIT, (j + 1) << LIGHTZSHIFT) >> LIGHTSCALESHIFT;
 
-            // killough 3/20/98: Initialize multiple colormaps
-            for (int t = 0; t < numcolormaps; t++)
-                c_zlight[t][i][j] = &colormaps[t][level];
+            ramp[j] = BETWEEN(0, start - scale / DISTMAP, NUMCOLORMAPS - 1) * 256;
         }
+
+        zlightbuilt[level] = true;
     }
+
+    return ramp;
 }
 
 //
@@ -452,21 +485,9 @@ void R_ExecuteSetViewSize(void)
 
     yslope = yslopes[LOOKDIRMAX];
 
-    // Calculate the light levels to use
-    //  for each level/scale combination.
-    for (int i = 0; i < LIGHTLEVELS; i++)
-    {
-        const int   start = ((LIGHTLEVELS - LIGHTBRIGHT - i) * 2) * NUMCOLORMAPS / LIGHTLEVELS;
-
-        for (int j = 0; j < MAXLIGHTSCALE; j++)
-        {
-            const int   level = BETWEEN(0, start - j * SCREENWIDTH / (viewwidth * DISTMAP), NUMCOLORMAPS - 1) * 256;
-
-            // killough 3/20/98: initialize multiple colormaps
-            for (int t = 0; t < numcolormaps; t++)
-                c_scalelight[t][i][j] = &colormaps[t][level];
-        }
-    }
+    // The light levels to use for each level/scale
+    //  combination are recalculated as they are needed.
+    memset(scalelightbuilt, false, sizeof(scalelightbuilt));
 
     // [BH] calculate separate light levels to use when drawing
     //  player's weapon, so it stays consistent regardless of view size
@@ -475,12 +496,7 @@ void R_ExecuteSetViewSize(void)
         const int   start = ((OLDLIGHTLEVELS - LIGHTBRIGHT - i) * 2) * NUMCOLORMAPS / OLDLIGHTLEVELS;
 
         for (int j = 0; j < OLDMAXLIGHTSCALE; j++)
-        {
-            const int   level = BETWEEN(0, start - j / DISTMAP, NUMCOLORMAPS - 1) * 256;
-
-            for (int t = 0; t < numcolormaps; t++)
-                c_psprscalelight[t][i][j] = &colormaps[t][level];
-        }
+            psprscalelight[i][j] = BETWEEN(0, start - j / DISTMAP, NUMCOLORMAPS - 1) * 256;
     }
 }
 
@@ -721,7 +737,6 @@ void R_Init(void)
     R_InitLightTables();
     R_InitTranslationTables();
     R_InitPatches();
-    R_InitDistortedFlats();
     R_InitColumnFunctions();
 }
 
@@ -809,9 +824,9 @@ static void R_SetupFrame(void)
 
         if (barrelms > time && !consoleactive && !menuactive && !paused)
         {
-            viewx += M_RandomInt(-3, 3) * FRACUNIT * (barrelms - time) / BARRELMS;
-            viewy += M_RandomInt(-3, 3) * FRACUNIT * (barrelms - time) / BARRELMS;
-            viewz += M_RandomInt(-2, 2) * FRACUNIT * (barrelms - time) / BARRELMS;
+            viewx += M_CosmeticRandomInt(-3, 3) * FRACUNIT * (barrelms - time) / BARRELMS;
+            viewy += M_CosmeticRandomInt(-3, 3) * FRACUNIT * (barrelms - time) / BARRELMS;
+            viewz += M_CosmeticRandomInt(-2, 2) * FRACUNIT * (barrelms - time) / BARRELMS;
         }
     }
 
@@ -835,16 +850,10 @@ static void R_SetupFrame(void)
     }
 
     fullcolormap = colormaps[cm];
-    zlight = c_zlight[cm];
-    scalelight = c_scalelight[cm];
-    psprscalelight = c_psprscalelight[cm];
     drawbloodsplats = (r_blood != r_blood_none && r_bloodsplats_max && !vanilla);
 
     if (viewplayer->fixedcolormap && r_textures)
     {
-        // killough 3/20/98: localize scalelightfixed (readability/optimization)
-        static lighttable_t *scalelightfixed[MAXLIGHTSCALE];
-
         // killough 3/20/98: use fullcolormap
         fixedcolormap = fullcolormap;
 
@@ -852,10 +861,6 @@ static void R_SetupFrame(void)
             fixedcolormap += 32 * 256 * sizeof(lighttable_t);
 
         usebrightmaps = false;
-        walllights = scalelightfixed;
-
-        for (int i = 0; i < MAXLIGHTSCALE; i++)
-            scalelightfixed[i] = fixedcolormap;
     }
     else
     {
@@ -873,18 +878,27 @@ void R_RenderPlayerView(void)
 {
     R_SetupFrame();
 
+    // [BH] if in automap, only mark the lines that can be seen, once a tic
+    if (automapactive)
+    {
+        static int  mappedtime = -1;
+
+        if (mappedtime != gametime)
+        {
+            mappedtime = gametime;
+            R_ClearClipSegs();
+            R_MapBSPNode(numnodes - 1);
+        }
+
+        return;
+    }
+
     // Clear buffers.
     R_ClearClipSegs();
     R_ClearDrawSegs();
     R_ClearPlanes();
     R_ClearSprites();
 
-    if (automapactive)
-    {
-        R_RenderBSPNode(numnodes - 1);
-        return;
-    }
-
     if (r_homindicator)
         V_FillRect(0, viewwindowx, viewwindowy, viewwidth, viewheight,
             nearestcolors[((leveltime % 20) < 9 ? RED : (viewplayer->fixedcolormap == INVERSECOLORMAP ? WHITE : BLACK))], false);
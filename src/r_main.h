@@ -82,10 +82,11 @@ extern int      validcount;
 // There a 0-31, i.e. 32 LUT in the COLORMAP lump.
 #define NUMCOLORMAPS        32
 
+// [BH] Offset of a light level's colormap from the start of fullcolormap.
+typedef unsigned short lightoffset_t;
+
 // killough 3/20/98: Allow colormaps to be dynamic (e.g. underwater)
-extern lighttable_t *(*scalelight)[MAXLIGHTSCALE];
-extern lighttable_t *(*zlight)[MAXLIGHTZ];
-extern lighttable_t *(*psprscalelight)[OLDMAXLIGHTSCALE];
+extern lightoffset_t psprscalelight[OLDLIGHTLEVELS][OLDMAXLIGHTSCALE];
 extern lighttable_t *fullcolormap;
 extern int          numcolormaps;   // killough 4/4/98: dynamic number of maps
 extern lighttable_t **colormaps;
@@ -155,6 +156,8 @@ void R_Init(void);
 void R_SetViewSize(int blocks);
 
 void R_InitLightTables(void);
+const lightoffset_t *R_ScaleLight(const int level);
+const lightoffset_t *R_ZLight(const int level);
 void R_InitColumnFunctions(void);
 
 #endif
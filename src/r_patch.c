@@ -67,7 +67,9 @@
 */
 
 #include "c_console.h"
+#include "i_colors.h"
 #include "i_swap.h"
+#include "i_video.h"
 #include "m_misc.h"
 #include "r_main.h"
 #include "w_wad.h"
@@ -85,6 +87,10 @@
 static rpatch_t     *patches;
 static rpatch_t     *texture_composites;
 
+// [BH] lower resolution versions of each texture composite, created as needed
+static rpatch_t     *texture_mips[NUMMIPLEVELS];
+static byte         *texture_maxmiplevel;
+
 static short        BIGDOOR7;
 static short        FIREBLU1;
 static short        SKY1;
@@ -210,7 +216,7 @@ static void createPatch(int id)
 
     // allocate our data chunk
     dataSize = pixelDataSize + columnsDataSize + postsDataSize;
-    patch->data = Z_Calloc(1, dataSize, PU_CACHE, (void **)&patch->data);
+    patch->data = Z_Calloc(1, dataSize, PU_STATIC, (void **)&patch->data);
 
     // set out pixel, column, and post pointers into our data array
     patch->pixels = patch->data;
@@ -585,11 +591,75 @@ static void createTextureCompositePatch(int id)
     free(countsInColumn);
 }
 
+//
+// createTextureMipPatch
+// [BH] Creates a version of a texture composite that is 1/2, 1/4 or 1/8 the size
+//  by averaging each block of pixels and finding the nearest color in the palette.
+//  Only the pixels and columns are created, since it is only used for walls.
+//
+static void createTextureMipPatch(int id, int level)
+{
+    rpatch_t        *mip_patch = &texture_mips[level - 1][id];
+    const rpatch_t  *composite_patch = &texture_composites[id];
+    const int       size = 1 << level;
+    const int       area = size * size;
+    int             pixelDataSize;
+
+    mip_patch->width = MAX(1, composite_patch->width >> level);
+    mip_patch->height = composite_patch->height >> level;
+    mip_patch->widthmask = composite_patch->widthmask >> level;
+    mip_patch->leftoffset = 0;
+    mip_patch->topoffset = 0;
+
+    pixelDataSize = (mip_patch->width * mip_patch->height + 4) & ~3;
+
+    mip_patch->data = Z_Malloc(pixelDataSize + sizeof(rcolumn_t) * mip_patch->width, PU_STATIC, (void **)&mip_patch->data);
+    mip_patch->pixels = mip_patch->data;
+    mip_patch->columns = (rcolumn_t *)((unsigned char *)mip_patch->pixels + pixelDataSize);
+    mip_patch->posts = NULL;
+
+    for (int x = 0; x < mip_patch->width; x++)
+    {
+        rcolumn_t   *column = &mip_patch->columns[x];
+
+        column->pixels = &mip_patch->pixels[x * mip_patch->height];
+        column->numposts = 0;
+        column->posts = NULL;
+
+        for (int y = 0; y < mip_patch->height; y++)
+        {
+            int red = 0;
+            int green = 0;
+            int blue = 0;
+
+            for (int i = 0; i < size; i++)
+            {
+                const byte  *pixels = R_GetPatchColumnClamped(composite_patch, (x << level) + i)->pixels + (y << level);
+
+                for (int j = 0; j < size; j++)
+                {
+                    const byte  *color = &PLAYPAL[pixels[j] * 3];
+
+                    red += color[0];
+                    green += color[1];
+                    blue += color[2];
+                }
+            }
+
+            column->pixels[y] = FindNearestColor(PLAYPAL, red / area, green / area, blue / area);
+        }
+    }
+}
+
 void R_InitPatches(void)
 {
-    patches = calloc(numlumps, sizeof(rpatch_t));
+    patches = Z_Calloc(numlumps, sizeof(rpatch_t), PU_STATIC, NULL);
+
+    texture_composites = Z_Calloc(numtextures, sizeof(rpatch_t), PU_STATIC, NULL);
+    texture_maxmiplevel = Z_Calloc(numtextures, sizeof(byte), PU_STATIC, NULL);
 
-    texture_composites = calloc(numtextures, sizeof(rpatch_t));
+    for (int i = 0; i < NUMMIPLEVELS; i++)
+        texture_mips[i] = Z_Calloc(numtextures, sizeof(rpatch_t), PU_STATIC, NULL);
 
     BIGDOOR7 = R_CheckTextureNumForName("BIGDOOR7");
     FIREBLU1 = R_CheckTextureNumForName("FIREBLU1");
@@ -599,7 +669,20 @@ void R_InitPatches(void)
         createPatch(firstspritelump + i);
 
     for (int i = 0; i < numtextures; i++)
+    {
+        const rpatch_t  *composite_patch = &texture_composites[i];
+        int             level = 0;
+
         createTextureCompositePatch(i);
+
+        // only use levels that tile exactly the same as the original texture
+        while (level < NUMMIPLEVELS
+            && !(composite_patch->height & ((2 << level) - 1))
+            && composite_patch->widthmask + 1 >= (2U << level))
+            level++;
+
+        texture_maxmiplevel[i] = level;
+    }
 }
 
 const rpatch_t *R_CachePatchNum(int id)
@@ -612,6 +695,32 @@ const rpatch_t *R_CacheTextureCompositePatchNum(int id)
     return &texture_composites[id];
 }
 
+const rpatch_t *R_CacheTextureMipPatchNum(int id, int level)
+{
+    rpatch_t    *mip_patch = &texture_mips[level - 1][id];
+
+    if (!mip_patch->data)
+        createTextureMipPatch(id, level);
+
+    return mip_patch;
+}
+
+//
+// R_GetTextureMipLevel
+// [BH] Returns which version of a texture to use when drawing a wall column,
+//  from 0 (the original texture) up to NUMMIPLEVELS, based on how many
+//  texels are stepped over for each pixel
+//
+int R_GetTextureMipLevel(int id, fixed_t iscale)
+{
+    int level = 0;
+
+    while (level < texture_maxmiplevel[id] && iscale >= (2 * FRACUNIT) << level)
+        level++;
+
+    return level;
+}
+
 const rcolumn_t *R_GetPatchColumnWrapped(const rpatch_t *patch, int columnIndex)
 {
     while (columnIndex < 0)
@@ -39,6 +39,8 @@
 #if !defined(__R_PATCH_H__)
 #define __R_PATCH_H__
 
+#define NUMMIPLEVELS    3
+
 typedef struct
 {
     int             topdelta;
@@ -74,6 +76,8 @@ typedef struct
 const rpatch_t *R_CachePatchNum(int id);
 
 const rpatch_t *R_CacheTextureCompositePatchNum(int id);
+const rpatch_t *R_CacheTextureMipPatchNum(int id, int level);
+int R_GetTextureMipLevel(int id, fixed_t iscale);
 
 const rcolumn_t *R_GetPatchColumnWrapped(const rpatch_t *patch, int columnIndex);
 const rcolumn_t *R_GetPatchColumnClamped(const rpatch_t *patch, int columnIndex);
@@ -47,6 +47,16 @@
 #include "w_wad.h"
 
 #define MAXVISPLANES    384
+#define MAXPLANESPANS   8192
+
+// [BH] a span of a regular flat, queued by R_MakeSpans and drawn a row at a time
+typedef struct
+{
+    visplane_t      *plane;
+    int             x1;
+    int             x2;
+    int             next;
+} planespan_t;
 
 static visplane_t   *visplanes = NULL;
 static visplane_t   *lastvisplane;
@@ -63,7 +73,7 @@ int                 floorclip[SCREENWIDTH];     // dropoff overflow
 int                 ceilingclip[SCREENWIDTH];   // dropoff overflow
 
 // texture mapping
-static lighttable_t **planezlight;
+static const lightoffset_t  *planezlight;
 static fixed_t      planeheight;
 
 static fixed_t      xoffset, yoffset;           // killough 2/28/98: flat offsets
@@ -73,6 +83,43 @@ fixed_t             yslopes[LOOKDIRS][SCREENHEIGHT];
 
 static fixed_t      cachedheight[SCREENHEIGHT];
 
+static planespan_t  *planespans;
+static int          numplanespans;
+static int          firstrowspan[SCREENHEIGHT];
+static int          lastrowspan[SCREENHEIGHT];
+static int          toprow = SCREENHEIGHT;
+static int          bottomrow = -1;
+
+// [BH] Flats that already have a colormap applied, so that R_DrawLitSpan only
+//  needs a single lookup for each pixel. The tiles are kept in a two-way
+//  set-associative cache. A flat and colormap that isn't cached is only
+//  given a tile, replacing the least recently used one in its set, once at
+//  least as many of its pixels have been drawn as it takes to make one.
+#define LITFLATSETS 128
+
+typedef struct
+{
+    const lighttable_t  *colormap;
+    int                 lump;
+    unsigned int        lastused;
+    byte                tile[64 * 64];
+} litflat_t;
+
+typedef struct
+{
+    litflat_t           ways[2];
+    const lighttable_t  *colormap;
+    int                 lump;
+    int                 pixels;
+} litflatset_t;
+
+static litflatset_t litflats[LITFLATSETS];
+static unsigned int litflatclock;
+static int          litflatlump = -1;
+static const lighttable_t   *litcolormap;
+static byte         *littile;
+static byte         *flatsource;
+
 dboolean            r_liquid_current = r_liquid_current_default;
 dboolean            r_liquid_swirl = r_liquid_swirl_default;
 
@@ -80,6 +127,52 @@ extern fixed_t      animatedliquidxoffs;
 extern fixed_t      animatedliquidyoffs;
 extern dboolean     canmouselook;
 
+//
+// R_LitFlat
+// Returns the current flat with the given colormap applied, or NULL if it
+//  isn't worth caching yet.
+//
+static byte *R_LitFlat(const lighttable_t *colormap, int width)
+{
+    litflatset_t    *set;
+    litflat_t       *litflat;
+
+    if (colormap == litcolormap)
+        return littile;
+
+    set = &litflats[(litflatlump * 31 + (int)((uintptr_t)colormap >> 8)) & (LITFLATSETS - 1)];
+
+    if (set->ways[0].colormap == colormap && set->ways[0].lump == litflatlump)
+        litflat = &set->ways[0];
+    else if (set->ways[1].colormap == colormap && set->ways[1].lump == litflatlump)
+        litflat = &set->ways[1];
+    else
+    {
+        if (set->colormap != colormap || set->lump != litflatlump)
+        {
+            set->colormap = colormap;
+            set->lump = litflatlump;
+            set->pixels = 0;
+        }
+
+        if ((set->pixels += width) < 64 * 64)
+            return NULL;
+
+        litflat = (set->ways[0].lastused <= set->ways[1].lastused ? &set->ways[0] : &set->ways[1]);
+        litflat->colormap = colormap;
+        litflat->lump = litflatlump;
+        set->colormap = NULL;
+
+        for (int i = 0; i < 64 * 64; i++)
+            litflat->tile[i] = colormap[flatsource[i]];
+    }
+
+    litflat->lastused = ++litflatclock;
+    litcolormap = colormap;
+
+    return (littile = litflat->tile);
+}
+
 //
 // R_MapPlane
 //
@@ -122,13 +215,19 @@ static void R_MapPlane(int y, int x1, int x2)
     ds_xfrac = viewx + xoffset + viewcosdistance + dx * ds_xstep;
     ds_yfrac = -viewy + yoffset - viewsindistance + dx * ds_ystep;
 
-    ds_colormap = (fixedcolormap ? fixedcolormap : planezlight[MIN(distance >> LIGHTZSHIFT, MAXLIGHTZ - 1)]);
+    ds_colormap = (fixedcolormap ? fixedcolormap : fullcolormap + planezlight[MIN(distance >> LIGHTZSHIFT, MAXLIGHTZ - 1)]);
 
     ds_y = y;
     ds_x1 = x1;
     ds_x2 = x2;
 
-    spanfunc();
+    if (litflatlump >= 0 && (ds_source = R_LitFlat(ds_colormap, x2 - x1)))
+        R_DrawLitSpan();
+    else
+    {
+        ds_source = flatsource;
+        spanfunc();
+    }
 }
 
 //
@@ -144,8 +243,14 @@ void R_ClearPlanes(void)
         ceilingclip[i] = -1;
     }
 
+    for (int i = 0; i < viewheight; i++)
+        firstrowspan[i] = -1;
+
     lastvisplane = visplanes;
     lastopening = openings;
+    numplanespans = 0;
+    toprow = SCREENHEIGHT;
+    bottomrow = -1;
 
     // texture calculation
     memset(cachedheight, 0, sizeof(cachedheight));
@@ -278,6 +383,43 @@ visplane_t *R_CheckPlane(visplane_t *pl, int start, int stop)
     return pl;
 }
 
+//
+// R_QueueSpan
+// Adds a span to the end of its row, to be drawn later by R_DrawSpans.
+//
+static void R_QueueSpan(visplane_t *pl, int y, int x1, int x2)
+{
+    static int  maxplanespans;
+    planespan_t *span;
+
+    if (numplanespans == maxplanespans)
+    {
+        maxplanespans = (maxplanespans ? 2 * maxplanespans : MAXPLANESPANS);
+        planespans = I_Realloc(planespans, maxplanespans * sizeof(*planespans));
+    }
+
+    span = &planespans[numplanespans];
+    span->plane = pl;
+    span->x1 = x1;
+    span->x2 = x2;
+    span->next = -1;
+
+    if (firstrowspan[y] == -1)
+    {
+        firstrowspan[y] = numplanespans;
+
+        if (y < toprow)
+            toprow = y;
+
+        if (y > bottomrow)
+            bottomrow = y;
+    }
+    else
+        planespans[lastrowspan[y]].next = numplanespans;
+
+    lastrowspan[y] = numplanespans++;
+}
+
 //
 // R_MakeSpans
 //
@@ -288,10 +430,6 @@ static void R_MakeSpans(visplane_t *pl)
     static int  spanstart[SCREENHEIGHT];
     int         stop = pl->right + 1;
 
-    xoffset = pl->xoffset;
-    yoffset = pl->yoffset;
-    planeheight = ABS(pl->height - viewz);
-    planezlight = zlight[MIN((pl->lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1)];
     pl->top[pl->left - 1] = USHRT_MAX;
     pl->top[stop] = USHRT_MAX;
 
@@ -303,10 +441,10 @@ static void R_MakeSpans(visplane_t *pl)
         unsigned short  b2 = pl->bottom[x];
 
         for (; t1 < t2 && t1 <= b1; t1++)
-            R_MapPlane(t1, spanstart[t1], x);
+            R_QueueSpan(pl, t1, spanstart[t1], x);
 
         for (; b1 > b2 && b1 >= t1; b1--)
-            R_MapPlane(b1, spanstart[b1], x);
+            R_QueueSpan(pl, b1, spanstart[b1], x);
 
         while (t2 < t1 && t2 <= b2)
             spanstart[t2++] = x;
@@ -328,7 +466,30 @@ static void R_MakeSpans(visplane_t *pl)
 // 1 cycle per 32 units (2 in 64)
 #define SWIRLFACTOR2    (8192 / 32)
 
-static int  offsets[1024 * 4096];
+//
+// R_SwirlOffsets
+// [BH] The horizontal distortion of each texel is the sum of one term that only
+//  depends on its row and another that only depends on its column, and vice
+//  versa for its vertical distortion, so only 4 * 64 sines are needed for each
+//  tic rather than keeping a precalculated table for all 1,024 of them.
+//
+static void R_SwirlOffsets(int offset[4096], int i)
+{
+    int xrow[64], xcol[64];
+    int yrow[64], ycol[64];
+
+    for (int j = 0; j < 64; j++)
+    {
+        xrow[j] = (finesine[(j * SWIRLFACTOR + i * 5 + 900) & 8191] * AMP) >> FRACBITS;
+        xcol[j] = j + 128 + ((finesine[(j * SWIRLFACTOR2 + i * 4 + 300) & 8191] * AMP2) >> FRACBITS);
+        ycol[j] = (finesine[(j * SWIRLFACTOR + i * 3 + 700) & 8191] * AMP) >> FRACBITS;
+        yrow[j] = j + 128 + ((finesine[(j * SWIRLFACTOR2 + i * 4 + 1200) & 8191] * AMP2) >> FRACBITS);
+    }
+
+    for (int y = 0; y < 64; y++)
+        for (int x = 0; x < 64; x++)
+            offset[(y << 6) + x] = (((yrow[y] + ycol[x]) & 63) << 6) + ((xcol[x] + xrow[y]) & 63);
+}
 
 //
 // R_DistortedFlat
@@ -338,28 +499,21 @@ static int  offsets[1024 * 4096];
 static byte *R_DistortedFlat(int flatnum)
 {
     static byte distortedflat[4096];
+    static int  offset[4096];
     static int  prevleveltime = -1;
     static int  prevflatnum = -1;
-    static byte *normalflat;
-    static int  *offset;
 
-    if (prevleveltime != leveltime)
+    if (prevleveltime != leveltime || prevflatnum != flatnum)
     {
-        offset = &offsets[(leveltime & 1023) << 12];
-        prevleveltime = leveltime;
+        // [BH] the flat may have been purged from the cache since the last tic
+        const byte  *normalflat = W_CacheLumpNum(firstflat + flatnum);
 
-        if (prevflatnum != flatnum)
+        if (prevleveltime != leveltime)
         {
-            normalflat = lumpinfo[firstflat + flatnum]->cache;
-            prevflatnum = flatnum;
+            R_SwirlOffsets(offset, (leveltime & 1023) * SPEED);
+            prevleveltime = leveltime;
         }
 
-        for (int i = 0; i < 4096; i++)
-            distortedflat[i] = normalflat[offset[i]];
-    }
-    else if (prevflatnum != flatnum)
-    {
-        normalflat = lumpinfo[firstflat + flatnum]->cache;
         prevflatnum = flatnum;
 
         for (int i = 0; i < 4096; i++)
@@ -370,27 +524,161 @@ static byte *R_DistortedFlat(int flatnum)
 }
 
 //
-// R_InitDistortedFlats
-// [BH] Moved to separate function and called at startup
+// R_SamePlane
+// Returns true if spans from both visplanes can be drawn as one.
 //
-void R_InitDistortedFlats(void)
+static dboolean R_SamePlane(const visplane_t *pl1, const visplane_t *pl2)
 {
-    for (int i = 0, *offset = offsets; i < 1024 * SPEED; i += SPEED, offset += 4096)
-        for (int y = 0; y < 64; y++)
-            for (int x = 0; x < 64; x++)
+    return (pl1 == pl2 || (pl1->picnum == pl2->picnum && pl1->height == pl2->height && pl1->lightlevel == pl2->lightlevel
+        && pl1->xoffset == pl2->xoffset && pl1->yoffset == pl2->yoffset));
+}
+
+//
+// R_DrawSpans
+// Draws all queued spans row by row, so spans on the same row share the
+//  distance and step calculations in R_MapPlane, and adjoining spans of the
+//  same flat are drawn together.
+//
+static void R_DrawSpans(void)
+{
+    visplane_t  *pl = NULL;
+
+    for (int y = toprow; y <= bottomrow; y++)
+    {
+        int i = firstrowspan[y];
+
+        if (i == -1)
+            continue;
+
+        firstrowspan[y] = -1;
+
+        do
+        {
+            const planespan_t   *span = &planespans[i];
+            const int           x1 = span->x1;
+            int                 x2 = span->x2;
+
+            if (span->plane != pl)
+            {
+                const int   picnum = span->plane->picnum;
+
+                pl = span->plane;
+                xoffset = pl->xoffset;
+                yoffset = pl->yoffset;
+                planeheight = ABS(pl->height - viewz);
+                planezlight = R_ZLight(MIN((pl->lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1));
+                litcolormap = NULL;
+
+                if (terraintypes[picnum] != SOLID && r_liquid_swirl)
+                {
+                    flatsource = R_DistortedFlat(picnum);
+                    litflatlump = -1;
+                }
+                else
+                {
+                    flatsource = W_CacheLumpNum(flattranslation[picnum]);
+                    litflatlump = (spanfunc == R_DrawSpan ? flattranslation[picnum] : -1);
+                }
+            }
+
+            // merge any following spans of the same flat that adjoin this one
+            while ((i = span->next) != -1 && planespans[i].x1 == x2 && R_SamePlane(planespans[i].plane, pl))
             {
-                int x1, y1;
-                int sinvalue, sinvalue2;
+                span = &planespans[i];
+                x2 = span->x2;
+            }
+
+            R_MapPlane(y, x1, x2);
+        } while (i != -1);
+    }
+
+    numplanespans = 0;
+    toprow = SCREENHEIGHT;
+    bottomrow = -1;
+}
+
+//
+// R_DrawSkyColumns
+// [BH] Draws the normal sky using a cache of each column of the sky texture as
+//  it appears on the screen. The cache stays valid until the sky's vertical
+//  position, scale or colormap changes, so turning and scrolling skies only
+//  copy pixels from it.
+//
+static void R_DrawSkyColumns(const visplane_t *pl, const rpatch_t *tex_patch, const angle_t an, const int skyoffset)
+{
+    static byte             *skycache;
+    static dboolean         *skycached;
+    static int              skycachesize;
+    static int              skycachedsize;
+    static const rpatch_t   *cachedpatch;
+    static fixed_t          cachedtexturemid;
+    static fixed_t          cachediscale;
+    static int              cachedcentery;
+    static int              cachedviewheight;
+    static lighttable_t     *cachedcolormap;
+    static void             (*cachedcolfunc)(void);
+    const int               width = tex_patch->widthmask + 1;
+    void                    (*bufferfunc)(byte *) = (skycolfunc == R_DrawSkyColumn ?
+                                R_DrawSkyColumnToBuffer : R_DrawFlippedSkyColumnToBuffer);
+
+    if (tex_patch != cachedpatch || dc_texturemid != cachedtexturemid || dc_iscale != cachediscale
+        || centery != cachedcentery || viewheight != cachedviewheight || dc_colormap[0] != cachedcolormap
+        || skycolfunc != cachedcolfunc)
+    {
+        if (width * viewheight > skycachesize)
+        {
+            skycachesize = width * viewheight;
+            skycache = I_Realloc(skycache, skycachesize);
+        }
+
+        if (width > skycachedsize)
+        {
+            skycachedsize = width;
+            skycached = I_Realloc(skycached, skycachedsize * sizeof(*skycached));
+        }
+
+        memset(skycached, false, width * sizeof(*skycached));
+
+        cachedpatch = tex_patch;
+        cachedtexturemid = dc_texturemid;
+        cachediscale = dc_iscale;
+        cachedcentery = centery;
+        cachedviewheight = viewheight;
+        cachedcolormap = dc_colormap[0];
+        cachedcolfunc = skycolfunc;
+    }
+
+    for (int x = pl->left; x <= pl->right; x++)
+    {
+        const int   yl = pl->top[x];
+        const int   yh = pl->bottom[x];
 
-                sinvalue = finesine[(y * SWIRLFACTOR + i * 5 + 900) & 8191];
-                sinvalue2 = finesine[(x * SWIRLFACTOR2 + i * 4 + 300) & 8191];
-                x1 = x + 128 + ((sinvalue * AMP) >> FRACBITS) + ((sinvalue2 * AMP2) >> FRACBITS);
-                sinvalue = finesine[(x * SWIRLFACTOR + i * 3 + 700) & 8191];
-                sinvalue2 = finesine[(y * SWIRLFACTOR2 + i * 4 + 1200) & 8191];
-                y1 = y + 128 + ((sinvalue * AMP) >> FRACBITS) + ((sinvalue2 * AMP2) >> FRACBITS);
+        if (yl <= yh)
+        {
+            int     col = ((an + xtoviewangle[x]) >> ANGLETOSKYSHIFT) + skyoffset;
+            byte    *buffer;
+
+            while (col < 0)
+                col += tex_patch->width;
 
-                offset[(y << 6) + x] = ((y1 & 63) << 6) + (x1 & 63);
+            col &= tex_patch->widthmask;
+            buffer = &skycache[col * viewheight];
+
+            if (!skycached[col])
+            {
+                dc_yl = 0;
+                dc_yh = viewheight - 1;
+                dc_source = tex_patch->columns[col].pixels;
+                bufferfunc(buffer);
+                skycached[col] = true;
             }
+
+            dc_x = x;
+            dc_yl = yl;
+            dc_yh = yh;
+            R_DrawSkyColumnFromBuffer(buffer);
+        }
+    }
 }
 
 //
@@ -463,26 +751,33 @@ void R_DrawPlanes(void)
                 dc_iscale = skyiscale;
                 tex_patch = R_CacheTextureCompositePatchNum(texture);
 
-                for (int x = pl->left; x <= pl->right; x++)
-                {
-                    dc_yl = pl->top[x];
-                    dc_yh = pl->bottom[x];
-
-                    if (dc_yl <= dc_yh)
+                if (!(picnum & PL_SKYFLAT) && (skycolfunc == R_DrawSkyColumn || skycolfunc == R_DrawFlippedSkyColumn))
+                    R_DrawSkyColumns(pl, tex_patch, an, skyoffset);
+                else
+                    for (int x = pl->left; x <= pl->right; x++)
                     {
-                        dc_x = x;
-                        dc_source = R_GetTextureColumn(tex_patch, (((an + xtoviewangle[x]) ^ flip) >> ANGLETOSKYSHIFT) + skyoffset);
-                        skycolfunc();
+                        dc_yl = pl->top[x];
+                        dc_yh = pl->bottom[x];
+
+                        if (dc_yl <= dc_yh)
+                        {
+                            dc_x = x;
+                            dc_source = R_GetTextureColumn(tex_patch, (((an + xtoviewangle[x]) ^ flip) >> ANGLETOSKYSHIFT) + skyoffset);
+                            skycolfunc();
+                        }
                     }
-                }
             }
             else
             {
                 // regular flat
-                ds_source = (terraintypes[picnum] != SOLID && r_liquid_swirl ? R_DistortedFlat(picnum) :
-                    lumpinfo[flattranslation[picnum]]->cache);
-
                 R_MakeSpans(pl);
+
+                // [BH] draw swirling liquids straight away,
+                //  since they share the same distorted flat
+                if (terraintypes[picnum] != SOLID && r_liquid_swirl)
+                    R_DrawSpans();
             }
         }
+
+    R_DrawSpans();
 }
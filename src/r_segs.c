@@ -92,11 +92,12 @@ static fixed_t      topstep;
 static int64_t      bottomfrac;
 static fixed_t      bottomstep;
 
-lighttable_t        **walllights;
+static const lightoffset_t  *walllights;
 
 static int          *maskedtexturecol;  // dropoff overflow
 
 dboolean            r_brightmaps = r_brightmaps_default;
+dboolean            r_mipmaps = r_mipmaps_default;
 
 extern int          *openings;          // dropoff overflow
 extern fixed_t      animatedliquiddiff;
@@ -186,9 +187,9 @@ static void R_FixWiggle(sector_t *sector)
     }
 }
 
-static lighttable_t **GetLightTable(const int lightlevel)
+static const lightoffset_t *GetLightTable(const int lightlevel)
 {
-    return scalelight[BETWEEN(0, (lightlevel >> LIGHTSEGSHIFT) + extralight + curline->fakecontrast, LIGHTLEVELS - 1)];
+    return R_ScaleLight(BETWEEN(0, (lightlevel >> LIGHTSEGSHIFT) + extralight + curline->fakecontrast, LIGHTLEVELS - 1));
 }
 
 static void R_BlastMaskedSegColumn(const rcolumn_t *column)
@@ -285,7 +286,7 @@ void R_RenderMaskedSegRange(drawseg_t *ds, const int x1, const int x2)
 
             // calculate lighting
             if (!fixedcolormap)
-                dc_colormap[0] = walllights[MIN(spryscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
+                dc_colormap[0] = fullcolormap + walllights[MIN(spryscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
 
             dc_iscale = UINT_MAX / (unsigned int)spryscale;
 
@@ -295,6 +296,37 @@ void R_RenderMaskedSegRange(drawseg_t *ds, const int x1, const int x2)
         }
 }
 
+//
+// R_DrawWallTier
+// Draws the current column of a wall texture. If r_mipmaps is on, a lower
+//  resolution version of the texture is used if it is far enough away.
+//
+static void R_DrawWallTier(const int texnum, const int texturecolumn, byte *brightmap)
+{
+    const int       level = (r_mipmaps ? R_GetTextureMipLevel(texnum, dc_iscale) : 0);
+    const fixed_t   iscale = dc_iscale;
+
+    if (level)
+    {
+        dc_source = R_GetTextureColumn(R_CacheTextureMipPatchNum(texnum, level), texturecolumn >> level);
+        dc_texturemid >>= level;
+        dc_texheight >>= level;
+        dc_iscale >>= level;
+    }
+    else
+        dc_source = R_GetTextureColumn(R_CacheTextureCompositePatchNum(texnum), texturecolumn);
+
+    if (brightmap)
+    {
+        dc_brightmap = brightmap;
+        bmapwallcolfunc();
+    }
+    else
+        wallcolfunc();
+
+    dc_iscale = iscale;
+}
+
 //
 // R_RenderSegLoop
 // Draws zero, one, or two textures (and possibly a masked texture) for walls.
@@ -354,7 +386,7 @@ static void R_RenderSegLoop(void)
             texturecolumn = (rw_offset - FixedMul(finetangent[angle], rw_distance)) >> FRACBITS;
 
             if (!fixedcolormap)
-                dc_colormap[0] = walllights[MIN(rw_scale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
+                dc_colormap[0] = fullcolormap + walllights[MIN(rw_scale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
 
             dc_x = rw_x;
             dc_iscale = UINT_MAX / rw_scale;
@@ -371,17 +403,9 @@ static void R_RenderSegLoop(void)
                 R_DrawColorColumn();
             else
             {
-                dc_source = R_GetTextureColumn(R_CacheTextureCompositePatchNum(midtexture), texturecolumn);
                 dc_texturemid = rw_midtexturemid;
                 dc_texheight = midtexheight;
-
-                if (midbrightmap)
-                {
-                    dc_brightmap = midbrightmap;
-                    bmapwallcolfunc();
-                }
-                else
-                    wallcolfunc();
+                R_DrawWallTier(midtexture, texturecolumn, midbrightmap);
             }
 
             ceilingclip[rw_x] = viewheight;
@@ -406,18 +430,10 @@ static void R_RenderSegLoop(void)
                         R_DrawColorColumn();
                     else
                     {
-                        dc_source = R_GetTextureColumn(R_CacheTextureCompositePatchNum(toptexture), texturecolumn);
                         dc_texturemid = rw_toptexturemid + (dc_yl - centery + 1) * SPARKLEFIX;
                         dc_iscale -= SPARKLEFIX;
                         dc_texheight = toptexheight;
-
-                        if (topbrightmap)
-                        {
-                            dc_brightmap = topbrightmap;
-                            bmapwallcolfunc();
-                        }
-                        else
-                            wallcolfunc();
+                        R_DrawWallTier(toptexture, texturecolumn, topbrightmap);
                     }
 
                     ceilingclip[rw_x] = mid;
@@ -446,17 +462,9 @@ static void R_RenderSegLoop(void)
                         R_DrawColorColumn();
                     else
                     {
-                        dc_source = R_GetTextureColumn(R_CacheTextureCompositePatchNum(bottomtexture), texturecolumn);
                         dc_texturemid = rw_bottomtexturemid;
                         dc_texheight = bottomtexheight;
-
-                        if (bottombrightmap)
-                        {
-                            dc_brightmap = bottombrightmap;
-                            bmapwallcolfunc();
-                        }
-                        else
-                            wallcolfunc();
+                        R_DrawWallTier(bottomtexture, texturecolumn, bottombrightmap);
                     }
 
                     floorclip[rw_x] = mid;
@@ -473,7 +481,7 @@ static void R_RenderSegLoop(void)
             // add this info to the solid columns array for r_bsp.c
             if ((markceiling || markfloor) && floorclip[rw_x] <= ceilingclip[rw_x] + 1)
             {
-                solidcol[rw_x] = 1;
+                R_SetSolidColumn(rw_x);
                 didsolidcol = true;
             }
 
@@ -513,7 +521,7 @@ void R_StoreWallRange(const int start, const int stop)
 {
     int64_t             dx, dy;
     int64_t             dx1, dy1;
-    int64_t             len;
+    double              invlength;
     int                 worldtop;
     int                 worldbottom;
     int                 worldhigh = 0;
@@ -550,8 +558,8 @@ void R_StoreWallRange(const int start, const int stop)
     dy = curline->dy;
     dx1 = ((int64_t)viewx - curline->v1->x) >> 1;
     dy1 = ((int64_t)viewy - curline->v1->y) >> 1;
-    len = curline->length;
-    rw_distance = (fixed_t)((dy * dx1 - dx * dy1) / len) << 1;
+    invlength = curline->invlength;
+    rw_distance = (fixed_t)(int64_t)((dy * dx1 - dx * dy1) * invlength) << 1;
 
     ds_p->x1 = start;
     rw_x = start;
@@ -793,7 +801,7 @@ void R_StoreWallRange(const int start, const int stop)
     // calculate rw_offset (only needed for textured lines)
     if ((segtextured = (midtexture | toptexture | bottomtexture | maskedtexture)))
     {
-        rw_offset = (fixed_t)(((dx * dx1 + dy * dy1) / len) << 1) + sidedef->textureoffset + curline->offset;
+        rw_offset = (fixed_t)((int64_t)((dx * dx1 + dy * dy1) * invlength) << 1) + sidedef->textureoffset + curline->offset;
         rw_centerangle = ANG90 + viewangle - rw_normalangle;
 
         // calculate light table
@@ -61,7 +61,7 @@
 fixed_t                 pspritescale;
 fixed_t                 pspriteiscale;
 
-static lighttable_t     **spritelights;         // killough 1/25/98 made static
+static const lightoffset_t  *spritelights;     // killough 1/25/98 made static
 
 // constant arrays used for psprite clipping and initializing clipping
 int                     negonearray[SCREENWIDTH];
@@ -313,7 +313,7 @@ void R_InitSprites(void)
 
     R_InitSpriteDefs();
 
-    vissprites = malloc(num_vissprite_alloc * sizeof(*vissprites));
+    vissprites = I_Realloc(vissprites, num_vissprite_alloc * sizeof(*vissprites));
 }
 
 //
@@ -785,7 +785,7 @@ static void R_ProjectSprite(mobj_t *thing)
     else if ((frame & FF_FULLBRIGHT) && (rot <= 4 || rot >= 12 || thing->info->fullbright))
         vis->colormap[0] = fullcolormap;        // full bright
     else                                        // diminished light
-        vis->colormap[0] = spritelights[MIN(xscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
+        vis->colormap[0] = fullcolormap + spritelights[MIN(xscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
 }
 
 static void R_ProjectBloodSplat(const bloodsplat_t *splat)
@@ -886,7 +886,7 @@ static void R_ProjectBloodSplat(const bloodsplat_t *splat)
     vis->patch = splat->patch;
 
     // get light level
-    vis->colormap = (fixedcolormap ? fixedcolormap : spritelights[MIN(xscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)]);
+    vis->colormap = (fixedcolormap ? fixedcolormap : fullcolormap + spritelights[MIN(xscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)]);
 }
 
 //
@@ -904,7 +904,7 @@ void R_AddSprites(sector_t *sec, int lightlevel)
 
         if (splat && drawbloodsplats)
         {
-            spritelights = scalelight[MIN((lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1)];
+            spritelights = R_ScaleLight(MIN((lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1));
 
             do
             {
@@ -916,7 +916,7 @@ void R_AddSprites(sector_t *sec, int lightlevel)
                 return;
         }
         else if (thing)
-            spritelights = scalelight[MIN((lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1)];
+            spritelights = R_ScaleLight(MIN((lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1));
         else
             return;
 
@@ -927,7 +927,7 @@ void R_AddSprites(sector_t *sec, int lightlevel)
         if (!thing)
             return;
 
-        spritelights = scalelight[MIN((lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1)];
+        spritelights = R_ScaleLight(MIN((lightlevel >> LIGHTSEGSHIFT) + extralight, LIGHTLEVELS - 1));
         drawshadows = false;
     }
 
@@ -1068,7 +1068,7 @@ static void R_DrawPlayerSprite(pspdef_t *psp, dboolean invisibility, dboolean al
                 short    lightlevel = (sec->floorlightsec ? sec->floorlightsec->lightlevel : sec->lightlevel);
                 int      lightnum = (lightlevel >> OLDLIGHTSEGSHIFT) + extralight;
 
-                vis->colormap[0] = psprscalelight[MIN(lightnum, OLDLIGHTLEVELS - 1)][MIN(lightnum + 16, OLDMAXLIGHTSCALE - 1)];
+                vis->colormap[0] = fullcolormap + psprscalelight[MIN(lightnum, OLDLIGHTLEVELS - 1)][MIN(lightnum + 16, OLDMAXLIGHTSCALE - 1)];
             }
         }
     }
@@ -1119,6 +1119,74 @@ void R_DrawPlayerSprites(void)
     }
 }
 
+//
+// [BH] Drawsegs that can clip a sprite or bloodsplat, which are those with a
+//  silhouette or a masked mid texture, kept in the same order as drawsegs[]. As
+//  well as a list for the whole screen, there is one for each of DRAWSEGSTRIPS
+//  vertical strips, so a sprite inside a single strip only has to scan the
+//  drawsegs that overlap it.
+//
+#define DRAWSEGSTRIPS   8
+
+typedef struct
+{
+    drawseg_t   **drawsegs;
+    int         count;
+    int         max;
+} drawseglist_t;
+
+static drawseglist_t    clipdrawsegs;
+static drawseglist_t    maskeddrawsegs;
+static drawseglist_t    stripdrawsegs[DRAWSEGSTRIPS];
+
+static void R_AddToDrawSegList(drawseglist_t *list, drawseg_t *ds)
+{
+    if (list->count == list->max)
+    {
+        list->max = (list->max ? list->max * 2 : 128);
+        list->drawsegs = I_Realloc(list->drawsegs, list->max * sizeof(*list->drawsegs));
+    }
+
+    list->drawsegs[list->count++] = ds;
+}
+
+static int R_DrawSegStrip(const int x)
+{
+    return BETWEEN(0, x * DRAWSEGSTRIPS / viewwidth, DRAWSEGSTRIPS - 1);
+}
+
+static void R_SortDrawSegs(void)
+{
+    clipdrawsegs.count = 0;
+    maskeddrawsegs.count = 0;
+
+    for (int i = 0; i < DRAWSEGSTRIPS; i++)
+        stripdrawsegs[i].count = 0;
+
+    for (drawseg_t *ds = drawsegs; ds < ds_p; ds++)
+    {
+        const int   strip2 = R_DrawSegStrip(ds->x2);
+
+        if (!ds->silhouette && !ds->maskedtexturecol)
+            continue;
+
+        R_AddToDrawSegList(&clipdrawsegs, ds);
+
+        if (ds->maskedtexturecol)
+            R_AddToDrawSegList(&maskeddrawsegs, ds);
+
+        for (int i = R_DrawSegStrip(ds->x1); i <= strip2; i++)
+            R_AddToDrawSegList(&stripdrawsegs[i], ds);
+    }
+}
+
+static const drawseglist_t *R_GetDrawSegList(const int x1, const int x2)
+{
+    const int   strip = R_DrawSegStrip(x1);
+
+    return (strip == R_DrawSegStrip(x2) ? &stripdrawsegs[strip] : &clipdrawsegs);
+}
+
 //
 // R_DrawBloodSplatSprite
 //
@@ -1129,6 +1197,9 @@ static void R_DrawBloodSplatSprite(const bloodsplatvissprite_t *splat)
     const int   x1 = splat->x1;
     const int   x2 = splat->x2;
 
+    // [BH] only scan the drawsegs that could clip this bloodsplat
+    const drawseglist_t *list = R_GetDrawSegList(x1, x2);
+
     // initialize the clipping arrays
     for (int i = x1; i <= x2; i++)
     {
@@ -1138,14 +1209,15 @@ static void R_DrawBloodSplatSprite(const bloodsplatvissprite_t *splat)
 
     // Scan drawsegs from end to start for obscuring segs.
     // The first drawseg that has a greater scale is the clip seg.
-    for (drawseg_t *ds = ds_p; ds-- > drawsegs;)
+    for (int j = list->count; j-- > 0;)
     {
+        drawseg_t   *ds = list->drawsegs[j];
         int         r1;
         int         r2;
         const int   silhouette = ds->silhouette;
 
         // determine if the drawseg obscures the bloodsplat
-        if (ds->x1 > x2 || ds->x2 < x1 || (!silhouette && !ds->maskedtexturecol))
+        if (ds->x1 > x2 || ds->x2 < x1)
             continue;       // does not cover bloodsplat
 
         if (ds->maxscale < splat->scale || (ds->minscale < splat->scale && !R_PointOnSegSide(splat->gx, splat->gy, ds->curline)))
@@ -1219,9 +1291,8 @@ static void R_SortVisSprites(void)
 
         if (num_vissprite_ptrs < num_vissprite * 2)
         {
-            free(vissprite_ptrs);
             num_vissprite_ptrs = num_vissprite_alloc * 2;
-            vissprite_ptrs = malloc(num_vissprite_ptrs * sizeof(*vissprite_ptrs));
+            vissprite_ptrs = I_Realloc(vissprite_ptrs, num_vissprite_ptrs * sizeof(*vissprite_ptrs));
         }
 
         while (--i >= 0)
@@ -1231,55 +1302,204 @@ static void R_SortVisSprites(void)
     }
 }
 
-static void R_DrawSprite(const vissprite_t *spr)
+static drawseglist_t    minscaledrawsegs;
+static drawseglist_t    maxscaledrawsegs;
+static drawseglist_t    straddledrawsegs[DRAWSEGSTRIPS + 1];
+
+static byte             *mergeddrawsegs;
+static int              maxmergeddrawsegs;
+
+static int              clipenvelopetop[SCREENWIDTH];
+static int              clipenvelopebot[SCREENWIDTH];
+
+static fixed_t R_FrontScale(const drawseg_t *ds)
 {
-    int         cliptop[SCREENWIDTH];
-    int         clipbot[SCREENWIDTH];
-    const int   x1 = spr->x1;
-    const int   x2 = spr->x2;
+    return MIN(ds->minscale, ds->maxscale);
+}
 
-    // initialize the clipping arrays
-    for (int i = x1; i <= x2; i++)
+static int R_CompareMinScales(const void *a, const void *b)
+{
+    const fixed_t   scale1 = R_FrontScale(*(drawseg_t **)a);
+    const fixed_t   scale2 = R_FrontScale(*(drawseg_t **)b);
+
+    return (scale1 < scale2) - (scale1 > scale2);
+}
+
+static int R_CompareMaxScales(const void *a, const void *b)
+{
+    const fixed_t   scale1 = (*(drawseg_t **)a)->maxscale;
+    const fixed_t   scale2 = (*(drawseg_t **)b)->maxscale;
+
+    return (scale1 < scale2) - (scale1 > scale2);
+}
+
+static void R_CopyDrawSegList(drawseglist_t *dest, const drawseglist_t *src)
+{
+    if (dest->max < src->count)
     {
-        cliptop[i] = -1;
-        clipbot[i] = viewheight;
+        dest->max = src->max;
+        dest->drawsegs = I_Realloc(dest->drawsegs, dest->max * sizeof(*dest->drawsegs));
     }
 
-    // Scan drawsegs from end to start for obscuring segs.
-    // The first drawseg that has a greater scale is the clip seg.
-    for (drawseg_t *ds = ds_p; ds-- > drawsegs;)
+    if ((dest->count = src->count))
+        memcpy(dest->drawsegs, src->drawsegs, src->count * sizeof(*src->drawsegs));
+}
+
+static void R_ClipToDrawSeg(const drawseg_t *ds, int *cliptop, int *clipbot, const int x1, const int x2)
+{
+    const int   silhouette = ds->silhouette;
+    const int   r1 = MAX(ds->x1, x1);
+    const int   r2 = MIN(ds->x2, x2);
+
+    if (silhouette & SIL_TOP)
+        for (int i = r1; i <= r2; i++)
+            if (cliptop[i] < ds->sprtopclip[i])
+                cliptop[i] = ds->sprtopclip[i];
+
+    if (silhouette & SIL_BOTTOM)
+        for (int i = r1; i <= r2; i++)
+            if (clipbot[i] > ds->sprbottomclip[i])
+                clipbot[i] = ds->sprbottomclip[i];
+}
+
+//
+// R_ClipVisSprites
+// [BH] Work out the clipping arrays of every vissprite in a single sweep
+//  from front to back. A drawseg whose minscale and maxscale are both at
+//  least a sprite's scale is in front of that sprite and every sprite
+//  behind it, so it is merged into a running envelope once. A drawseg is
+//  added to a straddle set, one for each strip of the screen, once its
+//  maxscale is reached, and dropped from it once it is merged, so only
+//  the drawsegs that straddle a sprite's scale and overlap its strip need
+//  the line side test.
+//
+static void R_ClipVisSprites(void)
+{
+    static int      *clips;
+    static size_t   maxclips;
+    size_t          numclips = 0;
+    int             *clip;
+    int             nextmin = 0;
+    int             nextmax = 0;
+    const int       numdrawsegs = (int)(ds_p - drawsegs);
+
+    for (unsigned int i = 0; i < num_vissprite; i++)
+        numclips += 2 * (size_t)MAX(0, vissprites[i].x2 - vissprites[i].x1 + 1);
+
+    if (numclips > maxclips)
     {
-        int         r1;
-        int         r2;
-        const int   silhouette = ds->silhouette;
+        maxclips = numclips;
+        clips = I_Realloc(clips, maxclips * sizeof(*clips));
+    }
 
-        // determine if the drawseg obscures the sprite
-        if (ds->x1 > x2 || ds->x2 < x1 || (!silhouette && !ds->maskedtexturecol))
-            continue;       // does not cover sprite
+    if (numdrawsegs > maxmergeddrawsegs)
+    {
+        maxmergeddrawsegs = numdrawsegs;
+        mergeddrawsegs = I_Realloc(mergeddrawsegs, maxmergeddrawsegs * sizeof(*mergeddrawsegs));
+    }
 
-        if (ds->maxscale < spr->scale || (ds->minscale < spr->scale && !R_PointOnSegSide(spr->gx, spr->gy, ds->curline)))
+    if (numdrawsegs)
+        memset(mergeddrawsegs, false, numdrawsegs * sizeof(*mergeddrawsegs));
+
+    R_CopyDrawSegList(&minscaledrawsegs, &clipdrawsegs);
+    R_CopyDrawSegList(&maxscaledrawsegs, &clipdrawsegs);
+    qsort(minscaledrawsegs.drawsegs, minscaledrawsegs.count, sizeof(*minscaledrawsegs.drawsegs), &R_CompareMinScales);
+    qsort(maxscaledrawsegs.drawsegs, maxscaledrawsegs.count, sizeof(*maxscaledrawsegs.drawsegs), &R_CompareMaxScales);
+
+    // the last straddle set is for sprites that cross more than one strip
+    for (int i = 0; i <= DRAWSEGSTRIPS; i++)
+        straddledrawsegs[i].count = 0;
+
+    for (int i = 0; i < viewwidth; i++)
+    {
+        clipenvelopetop[i] = -1;
+        clipenvelopebot[i] = viewheight;
+    }
+
+    clip = clips;
+
+    // vissprite_ptrs[] is sorted from front to back
+    for (unsigned int i = 0; i < num_vissprite; i++)
+    {
+        vissprite_t     *spr = vissprite_ptrs[i];
+        const int       x1 = spr->x1;
+        const int       x2 = spr->x2;
+        const fixed_t   scale = spr->scale;
+        const int       strip = R_DrawSegStrip(x1);
+        drawseglist_t   *straddle = &straddledrawsegs[strip == R_DrawSegStrip(x2) ? strip : DRAWSEGSTRIPS];
+
+        // add the drawsegs that now reach in front of the sprite
+        while (nextmax < maxscaledrawsegs.count && maxscaledrawsegs.drawsegs[nextmax]->maxscale >= scale)
         {
-            // masked mid texture?
-            if (ds->maskedtexturecol)
-                R_RenderMaskedSegRange(ds, MAX(ds->x1, x1), MIN(ds->x2, x2));
+            drawseg_t   *ds = maxscaledrawsegs.drawsegs[nextmax++];
+            const int   strip2 = R_DrawSegStrip(ds->x2);
 
-            // seg is behind sprite
-            continue;
+            R_AddToDrawSegList(&straddledrawsegs[DRAWSEGSTRIPS], ds);
+
+            for (int j = R_DrawSegStrip(ds->x1); j <= strip2; j++)
+                R_AddToDrawSegList(&straddledrawsegs[j], ds);
         }
 
-        // clip this piece of the sprite
-        r1 = MAX(ds->x1, x1);
-        r2 = MIN(ds->x2, x2);
+        // merge in the drawsegs that are now wholly in front
+        while (nextmin < minscaledrawsegs.count && R_FrontScale(minscaledrawsegs.drawsegs[nextmin]) >= scale)
+        {
+            const drawseg_t *ds = minscaledrawsegs.drawsegs[nextmin++];
 
-        if (silhouette & SIL_TOP)
-            for (int i = r1; i <= r2; i++)
-                if (cliptop[i] < ds->sprtopclip[i])
-                    cliptop[i] = ds->sprtopclip[i];
+            mergeddrawsegs[ds - drawsegs] = true;
+            R_ClipToDrawSeg(ds, clipenvelopetop, clipenvelopebot, ds->x1, ds->x2);
+        }
 
-        if (silhouette & SIL_BOTTOM)
-            for (int i = r1; i <= r2; i++)
-                if (clipbot[i] > ds->sprbottomclip[i])
-                    clipbot[i] = ds->sprbottomclip[i];
+        spr->cliptop = clip - x1;
+        clip += MAX(0, x2 - x1 + 1);
+        spr->clipbot = clip - x1;
+        clip += MAX(0, x2 - x1 + 1);
+
+        for (int j = x1; j <= x2; j++)
+        {
+            spr->cliptop[j] = clipenvelopetop[j];
+            spr->clipbot[j] = clipenvelopebot[j];
+        }
+
+        // then the drawsegs that straddle the sprite but are on its near side
+        for (int j = 0; j < straddle->count; j++)
+        {
+            const drawseg_t *ds = straddle->drawsegs[j];
+
+            // drop drawsegs that have since been merged
+            if (mergeddrawsegs[ds - drawsegs])
+            {
+                straddle->drawsegs[j--] = straddle->drawsegs[--straddle->count];
+                continue;
+            }
+
+            if (ds->x1 > x2 || ds->x2 < x1 || !R_PointOnSegSide(spr->gx, spr->gy, ds->curline))
+                continue;
+
+            R_ClipToDrawSeg(ds, spr->cliptop, spr->clipbot, x1, x2);
+        }
+    }
+}
+
+static void R_DrawSprite(const vissprite_t *spr)
+{
+    int         *cliptop = spr->cliptop;
+    int         *clipbot = spr->clipbot;
+    const int   x1 = spr->x1;
+    const int   x2 = spr->x2;
+
+    // [BH] only scan the drawsegs that could be behind this sprite
+    const drawseglist_t *list = R_GetDrawSegList(x1, x2);
+
+    // render any masked mid textures behind the sprite
+    for (int j = list->count; j-- > 0;)
+    {
+        drawseg_t   *ds = list->drawsegs[j];
+
+        if (!ds->maskedtexturecol || ds->x1 > x2 || ds->x2 < x1)
+            continue;       // does not cover sprite
+
+        if (ds->maxscale < spr->scale || (ds->minscale < spr->scale && !R_PointOnSegSide(spr->gx, spr->gy, ds->curline)))
+            R_RenderMaskedSegRange(ds, MAX(ds->x1, x1), MIN(ds->x2, x2));
     }
 
     // killough 3/27/98:
@@ -1350,6 +1570,8 @@ void R_DrawMasked(void)
     interpolatesprites = (vid_capfps != TICRATE && !pausesprites);
     invulnerable = (viewplayer->fixedcolormap == INVERSECOLORMAP && r_translucency);
 
+    R_SortDrawSegs();
+
     // draw all blood splats
     i = num_bloodsplatvissprite;
 
@@ -1357,6 +1579,7 @@ void R_DrawMasked(void)
         R_DrawBloodSplatSprite(&bloodsplatvissprites[i]);
 
     R_SortVisSprites();
+    R_ClipVisSprites();
 
     // draw all other vissprites back to front
     i = num_vissprite;
@@ -1365,9 +1588,8 @@ void R_DrawMasked(void)
         R_DrawSprite(vissprite_ptrs[i]);
 
     // render any remaining masked mid textures
-    for (drawseg_t *ds = ds_p; ds-- > drawsegs;)
-        if (ds->maskedtexturecol)
-            R_RenderMaskedSegRange(ds, ds->x1, ds->x2);
+    for (int j = maskeddrawsegs.count; j-- > 0;)
+        R_RenderMaskedSegRange(maskeddrawsegs.drawsegs[j], maskeddrawsegs.drawsegs[j]->x1, maskeddrawsegs.drawsegs[j]->x2);
 
     // draw the psprites on top of everything
     if (r_playersprites && !inhelpscreens && !menuactive)
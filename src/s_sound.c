@@ -293,17 +293,17 @@ static int S_GetMusicNum(void)
                 mus_ddtblu
             };
 
-            mnum = nmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : gamemap) - 1];
+            mnum = nmus[(s_randommusic ? M_CosmeticRandomIntNoRepeat(1, 9, mnum) : gamemap) - 1];
         }
         else
-            mnum = mus_runnin + (s_randommusic ? M_RandomIntNoRepeat(1, 32, mnum) : gamemap) - 1;
+            mnum = mus_runnin + (s_randommusic ? M_CosmeticRandomIntNoRepeat(1, 32, mnum) : gamemap) - 1;
     }
     else
     {
         if (gameepisode < 4)
-            mnum = mus_e1m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 21, mnum) : (gameepisode - 1) * 9 + gamemap) - 1;
+            mnum = mus_e1m1 + (s_randommusic ? M_CosmeticRandomIntNoRepeat(1, 21, mnum) : (gameepisode - 1) * 9 + gamemap) - 1;
         else if (gameepisode == 5 && sigil)
-            mnum = mus_e5m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : gamemap) - 1;
+            mnum = mus_e5m1 + (s_randommusic ? M_CosmeticRandomIntNoRepeat(1, 9, mnum) : gamemap) - 1;
         else
         {
             int spmus[] =
@@ -320,7 +320,7 @@ static int S_GetMusicNum(void)
                 mus_e1m9    // Tim          E4M9
             };
 
-            mnum = spmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : gamemap) - 1];
+            mnum = spmus[(s_randommusic ? M_CosmeticRandomIntNoRepeat(1, 9, mnum) : gamemap) - 1];
         }
     }
 
@@ -654,7 +654,7 @@ void S_ChangeMusic(int music_id, dboolean looping, dboolean allowrestart, dboole
     else
     {
         // Load & register it
-        music->data = W_CacheLumpNum(music->lumpnum);
+        music->data = W_LockLumpNum(music->lumpnum);
         handle = I_RegisterSong(music->data, W_LumpLength(music->lumpnum));
     }
 
@@ -699,7 +699,7 @@ void S_StopMusic(void)
 
         I_StopSong();
         I_UnRegisterSong(mus_playing->handle);
-        W_ReleaseLumpNum(mus_playing->lumpnum);
+        W_UnlockLumpNum(mus_playing->lumpnum);
         mus_playing->data = NULL;
         mus_playing = NULL;
     }
@@ -727,7 +727,7 @@ void S_ChangeMusInfoMusic(int lumpnum, int looping)
     music->lumpnum = lumpnum;
 
     // load & register it
-    music->data = W_CacheLumpNum(music->lumpnum);
+    music->data = W_LockLumpNum(music->lumpnum);
     music->handle = I_RegisterSong(music->data, W_LumpLength(music->lumpnum));
 
     // play it
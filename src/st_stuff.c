@@ -1224,13 +1224,13 @@ void ST_Ticker(void)
     {
         if (!vid_widescreen)
         {
-            st_randomnumber = M_Random();
+            st_randomnumber = M_CosmeticRandom();
             ST_UpdateWidgets();
             st_oldhealth = viewplayer->health;
         }
         else if (r_hud && !paused && !menuactive && !consoleactive)
         {
-            st_randomnumber = M_Random();
+            st_randomnumber = M_CosmeticRandom();
             ST_UpdateFaceWidget();
             st_oldhealth = viewplayer->health;
         }
@@ -1471,11 +1471,11 @@ static void ST_LoadUnloadGraphics(load_callback_t callback)
 static void ST_LoadCallback(char *lumpname, patch_t **variable)
 {
     if (M_StringCompare(lumpname, "STARMS"))
-        *variable = (FREEDOOM || hacx ? W_CacheLastLumpName("STARMS") : W_CacheLumpName("STARMS"));
+        *variable = (FREEDOOM || hacx ? W_LockLastLumpName("STARMS") : W_LockLumpName("STARMS"));
     else if (M_StringCompare(lumpname, "STBAR"))
-        *variable = (FREEDOOM || hacx ? W_CacheLastLumpName("STBAR") : W_CacheLumpName("STBAR"));
+        *variable = (FREEDOOM || hacx ? W_LockLastLumpName("STBAR") : W_LockLumpName("STBAR"));
     else
-        *variable = W_CacheLumpName(lumpname);
+        *variable = W_LockLumpName(lumpname);
 }
 
 static void ST_LoadGraphics(void)
@@ -147,6 +147,46 @@ void V_FillTransRect(int scrn, int x, int y, int width, int height, int color, d
     }
 }
 
+//
+// V_IsDoubled
+// [BH] Returns true if patches are being drawn at exactly twice their size,
+//  so each pixel of a patch becomes a 2x2 block on the screen.
+//
+static dboolean V_IsDoubled(void)
+{
+    return (SCREENSCALE == 2 && DX == 2 * FRACUNIT && DY == 2 * FRACUNIT && DXI == FRACUNIT / 2 && DYI == FRACUNIT / 2);
+}
+
+//
+// V_DrawDoubledPatchColumn
+// [BH] Draws a column of a patch at twice its size into two adjacent columns
+//  on the screen at once, walking its posts only once and without stepping
+//  through the column in fixed point.
+//
+static void V_DrawDoubledPatchColumn(byte *desttop, const column_t *column)
+{
+    // step through the posts in a column
+    while (column->topdelta != 0xFF)
+    {
+        const byte  *source = (const byte *)column + 3;
+        byte        *dest = &desttop[column->topdelta * 2 * SCREENWIDTH];
+        int         count = column->length;
+
+        while (count--)
+        {
+            const byte  dot = *source++;
+
+            dest[0] = dot;
+            dest[1] = dot;
+            dest[SCREENWIDTH] = dot;
+            dest[SCREENWIDTH + 1] = dot;
+            dest += SCREENWIDTH * 2;
+        }
+
+        column = (const column_t *)((const byte *)column + column->length + 4);
+    }
+}
+
 //
 // V_DrawPatch
 // Masks a column based masked pic to the screen.
@@ -161,6 +201,14 @@ void V_DrawPatch(int x, int y, int scrn, patch_t *patch)
 
     desttop = &screens[scrn][((y * DY) >> FRACBITS) * SCREENWIDTH + ((x * DX) >> FRACBITS)];
 
+    if (V_IsDoubled())
+    {
+        for (int col = 0; col < w; col += FRACUNIT, desttop += 2)
+            V_DrawDoubledPatchColumn(desttop, (column_t *)((byte *)patch + LONG(patch->columnofs[col >> FRACBITS])));
+
+        return;
+    }
+
     for (int col = 0; col < w; col += DXI, desttop++)
     {
         column_t    *column = (column_t *)((byte *)patch + LONG(patch->columnofs[col >> FRACBITS]));
@@ -201,6 +249,14 @@ void V_DrawSTBARPatch(int x, int y, patch_t *patch)
     col <<= FRACBITS;
     desttop = &screens[0][((y * DY) >> FRACBITS) * SCREENWIDTH + ((x * DX) >> FRACBITS)];
 
+    if (V_IsDoubled())
+    {
+        for (; col < w; col += FRACUNIT, desttop += 2)
+            V_DrawDoubledPatchColumn(desttop, (column_t *)((byte *)patch + LONG(patch->columnofs[col >> FRACBITS])));
+
+        return;
+    }
+
     for (; col < w; col += DXI, desttop++)
     {
         column_t    *column = (column_t *)((byte *)patch + LONG(patch->columnofs[col >> FRACBITS]));
@@ -351,7 +407,7 @@ void V_DrawSpectreShadowPatch(int x, int y, patch_t *patch)
             byte    *dest = &desttop[((column->topdelta * DY / 10) >> FRACBITS) * SCREENWIDTH];
             int     count = ((column->length * DY / 10) >> FRACBITS) + 1;
 
-            if ((consoleactive && !fuzztable[fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = shadow[*dest];
 
             dest += SCREENWIDTH;
@@ -362,7 +418,7 @@ void V_DrawSpectreShadowPatch(int x, int y, patch_t *patch)
                 dest += SCREENWIDTH;
             }
 
-            if ((consoleactive && !fuzztable[fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = shadow[*dest];
 
             column = (column_t *)((byte *)column + column->length + 4);
@@ -391,7 +447,7 @@ void V_DrawSolidSpectreShadowPatch(int x, int y, patch_t *patch)
             byte    *dest = &desttop[((column->topdelta * DY / 10) >> FRACBITS) * SCREENWIDTH];
             int     count = ((column->length * DY / 10) >> FRACBITS) + 1;
 
-            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = nearestblack;
 
             dest += SCREENWIDTH;
@@ -402,7 +458,7 @@ void V_DrawSolidSpectreShadowPatch(int x, int y, patch_t *patch)
                 dest += SCREENWIDTH;
             }
 
-            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = nearestblack;
 
             column = (column_t *)((byte *)column + column->length + 4);
@@ -1115,7 +1171,7 @@ void V_DrawFlippedSpectreShadowPatch(int x, int y, patch_t *patch)
             byte    *dest = &desttop[((column->topdelta * DY / 10) >> FRACBITS) * SCREENWIDTH];
             int     count = ((column->length * DY / 10) >> FRACBITS) + 1;
 
-            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = shadow[*dest];
 
             dest += SCREENWIDTH;
@@ -1126,7 +1182,7 @@ void V_DrawFlippedSpectreShadowPatch(int x, int y, patch_t *patch)
                 dest += SCREENWIDTH;
             }
 
-            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = shadow[*dest];
 
             column = (column_t *)((byte *)column + column->length + 4);
@@ -1155,7 +1211,7 @@ void V_DrawFlippedSolidSpectreShadowPatch(int x, int y, patch_t *patch)
             byte    *dest = &desttop[((column->topdelta * DY / 10) >> FRACBITS) * SCREENWIDTH];
             int     count = ((column->length * DY / 10) >> FRACBITS) + 1;
 
-            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = nearestblack;
 
             dest += SCREENWIDTH;
@@ -1166,7 +1222,7 @@ void V_DrawFlippedSolidSpectreShadowPatch(int x, int y, patch_t *patch)
                 dest += SCREENWIDTH;
             }
 
-            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_Random() & 3)))
+            if ((consoleactive && !fuzztable[_fuzzpos++]) || (!consoleactive && !(M_RenderRandom(&fuzzseed) & 3)))
                 *dest = nearestblack;
 
             column = (column_t *)((byte *)column + column->length + 4);
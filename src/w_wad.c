@@ -563,12 +563,121 @@ void *W_CacheLumpNum(int lumpnum)
     lumpinfo_t  *lump = lumpinfo[lumpnum];
 
     if (!lump->cache)
+    {
         W_ReadLump(lumpnum, Z_Malloc(lump->size, PU_CACHE, &lump->cache));
+        lump->prefetched = false;
+        loaderstats.misses++;
+        loaderstats.missedbytes += lump->size;
+    }
+    else
+    {
+        // [BH] keep lumps that are used every frame from being the first purged
+        Z_Touch(lump->cache);
+
+        // [BH] only count the first time a lump that was read ahead is needed
+        if (lump->prefetched)
+        {
+            lump->prefetched = false;
+            loaderstats.hits++;
+        }
+    }
 
     return lump->cache;
 }
 
 void W_ReleaseLumpNum(int lumpnum)
 {
-    Z_ChangeTag(lumpinfo[lumpnum]->cache, PU_CACHE);
+    // cph - don't make a lump purgeable while something still has it locked
+    if (!lumpinfo[lumpnum]->locks)
+        Z_ChangeTag(lumpinfo[lumpnum]->cache, PU_CACHE);
+}
+
+//
+// W_LockLumpNum
+// cph - Caches a lump, and keeps it from being purged until every caller that
+//  has locked it has also called W_UnlockLumpNum(). Only for lumps that are held
+//  onto beyond the current frame. Everything else should use W_CacheLumpNum().
+//
+void *W_LockLumpNum(int lumpnum)
+{
+    lumpinfo_t  *lump = lumpinfo[lumpnum];
+    void        *cache = W_CacheLumpNum(lumpnum);
+
+    if (!lump->locks++)
+        Z_ChangeTag(cache, PU_STATIC);
+
+    return cache;
+}
+
+void W_UnlockLumpNum(int lumpnum)
+{
+    lumpinfo_t  *lump = lumpinfo[lumpnum];
+
+    if (lump->locks > 0 && !--lump->locks)
+        Z_ChangeTag(lump->cache, PU_CACHE);
+}
+
+//
+// [BH] Lumps are queued to be read ahead of time by the code that knows they
+//  will soon be needed, and are read in a lump at a time, highest priority
+//  first, by W_LoadQueuedLump(), which G_Ticker() calls once a tic. They are left
+//  unlocked in the cache, so W_CacheLumpNum() finds them there later, and they can
+//  be purged like any other released lump if memory gets tight.
+//
+loaderstats_t   loaderstats;
+
+static int      *lumpqueue[NUMLOADERPRIORITIES];
+static int      lumpqueuehead[NUMLOADERPRIORITIES];
+static int      lumpqueuetail[NUMLOADERPRIORITIES];
+static int      maxlumpqueue[NUMLOADERPRIORITIES];
+
+void W_QueueLump(int lumpnum, loaderpriority_t priority)
+{
+    if (lumpnum < 0 || lumpnum >= numlumps)
+        return;
+
+    if (lumpqueuetail[priority] == maxlumpqueue[priority])
+    {
+        maxlumpqueue[priority] = (maxlumpqueue[priority] ? maxlumpqueue[priority] * 2 : 64);
+        lumpqueue[priority] = I_Realloc(lumpqueue[priority], maxlumpqueue[priority] * sizeof(*lumpqueue[priority]));
+    }
+
+    lumpqueue[priority][lumpqueuetail[priority]++] = lumpnum;
+    loaderstats.queued[priority]++;
+}
+
+void W_ClearLumpQueue(loaderpriority_t priority)
+{
+    lumpqueuehead[priority] = 0;
+    lumpqueuetail[priority] = 0;
+}
+
+int W_QueuedLumps(loaderpriority_t priority)
+{
+    return (lumpqueuetail[priority] - lumpqueuehead[priority]);
+}
+
+void W_LoadQueuedLump(loaderpriority_t lowestpriority)
+{
+    for (loaderpriority_t priority = 0; priority <= lowestpriority; priority++)
+        while (lumpqueuehead[priority] < lumpqueuetail[priority])
+        {
+            const int   lumpnum = lumpqueue[priority][lumpqueuehead[priority]++];
+            lumpinfo_t  *lump = lumpinfo[lumpnum];
+
+            if (!lump->size)
+                continue;
+
+            if (lump->cache)
+            {
+                loaderstats.alreadycached++;
+                continue;
+            }
+
+            W_ReadLump(lumpnum, Z_Malloc(lump->size, PU_CACHE, &lump->cache));
+            lump->prefetched = true;
+            loaderstats.loaded[priority]++;
+            loaderstats.loadedbytes += lump->size;
+            return;
+        }
 }
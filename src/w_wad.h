@@ -60,6 +60,8 @@ struct lumpinfo_s
     char        name[9];
     int         size;
     void        *cache;
+    int         locks;          // cph - number of W_LockLumpNum() calls not yet unlocked
+    dboolean    prefetched;     // [BH] read ahead by W_LoadQueuedLump() and not yet needed
 
     // killough 1/31/98: hash table fields, used for ultra-fast hash table lookup
     int         index;
@@ -105,6 +107,39 @@ void W_ReleaseLumpNum(int lumpnum);
 
 #define W_ReleaseLumpName(name)     W_ReleaseLumpNum(W_GetNumForName(name))
 
+void *W_LockLumpNum(int lumpnum);
+void W_UnlockLumpNum(int lumpnum);
+
+#define W_LockLumpName(name)        W_LockLumpNum(W_GetNumForName(name))
+#define W_LockLastLumpName(name)    W_LockLumpNum(W_GetLastNumForName(name))
+#define W_UnlockLumpName(name)      W_UnlockLumpNum(W_GetNumForName(name))
+
+// [BH] Lumps that are read ahead of time, a lump a tic, by W_LoadQueuedLump()
+typedef enum
+{
+    LOADER_LEVEL,           // the next map
+    LOADER_SPECULATIVE,     // lumps that may be needed, such as the intermission's
+    NUMLOADERPRIORITIES
+} loaderpriority_t;
+
+typedef struct
+{
+    int         queued[NUMLOADERPRIORITIES];
+    int         loaded[NUMLOADERPRIORITIES];
+    int         alreadycached;      // queued lumps that were cached by the time they were reached
+    size_t      loadedbytes;
+    int         hits;               // lumps read ahead that W_CacheLumpNum() then needed
+    int         misses;             // W_CacheLumpNum() calls that had to read the lump
+    size_t      missedbytes;
+} loaderstats_t;
+
+extern loaderstats_t    loaderstats;
+
+void W_QueueLump(int lumpnum, loaderpriority_t priority);
+void W_ClearLumpQueue(loaderpriority_t priority);
+int W_QueuedLumps(loaderpriority_t priority);
+void W_LoadQueuedLump(loaderpriority_t lowestpriority);
+
 GameMission_t IWADRequiredByPWAD(char *pwadname);
 dboolean HasDehackedLump(const char *pwadname);
 
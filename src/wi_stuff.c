@@ -508,7 +508,7 @@ static void WI_InitAnimatedBack(void)
 
         // specify the next time to draw it
         if (a->type == ANIM_ALWAYS)
-            a->nexttic = bcnt + 1 + (M_Random() % a->period);
+            a->nexttic = bcnt + 1 + (M_CosmeticRandom() % a->period);
         else if (a->type == ANIM_LEVEL)
             a->nexttic = bcnt + 1;
     }
@@ -1117,7 +1117,18 @@ static void WI_LoadUnloadData(load_callback_t callback)
 
 static void WI_LoadCallback(char *name, patch_t **variable)
 {
-    *variable = (patch_t *)W_CacheLumpName(name);
+    *variable = (patch_t *)W_LockLumpName(name);
+}
+
+// Background image
+static void WI_GetBackgroundName(char *bg_lumpname)
+{
+    if (gamemode == commercial || (gamemode == retail && wbs->epsd == 3))
+        M_StringCopy(bg_lumpname, (DMENUPIC && W_CheckMultipleLumps("INTERPIC") == 1 ? "DMENUPIC" : "INTERPIC"), 9);
+    else if (sigil && wbs->epsd == 4)
+        M_StringCopy(bg_lumpname, "SIGILINT", 9);
+    else
+        M_snprintf(bg_lumpname, 9, "WIMAP%i", wbs->epsd);
 }
 
 static void WI_LoadData(void)
@@ -1137,20 +1148,13 @@ static void WI_LoadData(void)
     // These two graphics are special cased because we're sharing
     // them with the status bar code
 
-    // Background image
-    if (gamemode == commercial || (gamemode == retail && wbs->epsd == 3))
-        M_StringCopy(bg_lumpname, (DMENUPIC && W_CheckMultipleLumps("INTERPIC") == 1 ? "DMENUPIC" : "INTERPIC"), sizeof(bg_lumpname));
-    else if (sigil && wbs->epsd == 4)
-        M_StringCopy(bg_lumpname, "SIGILINT", sizeof(bg_lumpname));
-    else
-        M_snprintf(bg_lumpname, sizeof(bg_lumpname), "WIMAP%i", wbs->epsd);
-
+    WI_GetBackgroundName(bg_lumpname);
     V_DrawPatch(0, 0, 1, W_CacheLumpName(bg_lumpname));
 }
 
 static void WI_UnloadCallback(char *name, patch_t **variable)
 {
-    W_ReleaseLumpName(name);
+    W_UnlockLumpName(name);
     *variable = NULL;
 }
 
@@ -1159,6 +1163,46 @@ static void WI_UnloadData(void)
     WI_LoadUnloadData(WI_UnloadCallback);
 }
 
+//
+// [BH] Queue the graphics the intermission at the end of the current map will
+//  need, so that they are read in while the map is being played and are already
+//  cached by the time WI_Start() is called.
+//
+static void WI_PrefetchCallback(char *name, patch_t **variable)
+{
+    W_QueueLump(W_CheckNumForName(name), LOADER_SPECULATIVE);
+}
+
+void WI_StartPrefetch(void)
+{
+    wbstartstruct_t prefetchwbs;
+    wbstartstruct_t *oldwbs = wbs;
+    patch_t         *prefetchlnames[33];    // enough for CWILV00 to CWILV32
+    patch_t         **oldlnames = lnames;
+    char            bg_lumpname[9];
+
+    W_ClearLumpQueue(LOADER_SPECULATIVE);
+
+    memset(&prefetchwbs, 0, sizeof(prefetchwbs));
+    prefetchwbs.epsd = gameepisode - 1;
+
+    if (gamemode != retail && prefetchwbs.epsd > 2)
+        prefetchwbs.epsd -= 3;
+
+    wbs = &prefetchwbs;
+    lnames = prefetchlnames;
+
+    if (gamemode == commercial)
+        NUMCMAPS = 32 + (W_CheckNumForName("CWILV32") >= 0);
+
+    WI_GetBackgroundName(bg_lumpname);
+    WI_PrefetchCallback(bg_lumpname, NULL);
+    WI_LoadUnloadData(WI_PrefetchCallback);
+
+    wbs = oldwbs;
+    lnames = oldlnames;
+}
+
 void WI_Drawer(void)
 {
     switch (state)
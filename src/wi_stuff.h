@@ -57,6 +57,9 @@ void WI_Drawer(void);
 // Setup for an intermission screen.
 void WI_Start(wbstartstruct_t *wbstartstruct);
 
+// Queue the graphics for the intermission at the end of the current map.
+void WI_StartPrefetch(void);
+
 // Shut down the intermission screen
 void WI_End(void);
 
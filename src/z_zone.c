@@ -37,6 +37,7 @@
 */
 
 #include "i_system.h"
+#include "m_misc.h"
 #include "z_zone.h"
 
 // Minimum chunk size at which blocks are allocated
@@ -49,8 +50,19 @@ typedef struct memblock_s
     size_t              size;
     void                **user;
     unsigned char       tag;
+    const char          *file;                          // [BH] call site, for memreport CCMD
+    int                 line;
 } memblock_t;
 
+// [BH] an array grown by I_Realloc() rather than allocated from the zone
+typedef struct
+{
+    void                *ptr;
+    size_t              size;
+    const char          *file;
+    int                 line;
+} zonearray_t;
+
 // size of block header
 // cph - base on sizeof(memblock_t), which can be larger than CHUNK_SIZE on
 // 64bit architectures
@@ -58,6 +70,33 @@ static const size_t headersize = (sizeof(memblock_t) + CHUNK_SIZE - 1) & ~(CHUNK
 
 static memblock_t   *blockbytag[PU_MAX];
 
+// [BH] arrays grown by I_Realloc(), in an open-addressed hash table keyed by
+//  pointer, so that tracking them doesn't slow down as their number grows
+static zonearray_t  *arrays;
+static int          numarrays;
+static int          maxarrays;
+
+static size_t       purgethreshold;
+
+zonestats_t         zonestats;
+
+static void Z_AddBytes(size_t *bytes, size_t size)
+{
+    *bytes += size;
+
+    if ((zonestats.current += size) > zonestats.peak)
+        zonestats.peak = zonestats.current;
+
+    if (zonestats.current > zonestats.levelpeak)
+        zonestats.levelpeak = zonestats.current;
+}
+
+static void Z_SubtractBytes(size_t *bytes, size_t size)
+{
+    *bytes -= size;
+    zonestats.current -= size;
+}
+
 //
 // Z_Malloc
 // You can pass a NULL user if the tag is < PU_PURGELEVEL.
@@ -70,7 +109,7 @@ static memblock_t   *blockbytag[PU_MAX];
 // but we only free the blocks we actually end up using; we don't
 // free all the stuff we just pass on the way.
 //
-void *Z_Malloc(size_t size, int tag, void **user)
+void *Z_MallocEx(size_t size, int tag, void **user, const char *file, int line)
 {
     memblock_t  *block = NULL;
 
@@ -84,7 +123,8 @@ void *Z_Malloc(size_t size, int tag, void **user)
         if (!blockbytag[PU_CACHE])
             I_Error("Z_Malloc: Failure trying to allocate %lu bytes", (unsigned long)size);
 
-        Z_FreeTags(PU_CACHE, PU_CACHE);
+        // [BH] free the least recently used block rather than every one
+        Z_Free((char *)blockbytag[PU_CACHE] + headersize);
     }
 
     if (!blockbytag[tag])
@@ -104,6 +144,9 @@ void *Z_Malloc(size_t size, int tag, void **user)
 
     block->tag = tag;                                   // tag
     block->user = user;                                 // user
+    block->file = file;
+    block->line = line;
+    Z_AddBytes(&zonestats.tagbytes[tag], size + headersize);
     block = (memblock_t *)((char *)block + headersize);
 
     if (user)                                           // if there is a user
@@ -112,9 +155,9 @@ void *Z_Malloc(size_t size, int tag, void **user)
     return block;
 }
 
-void *Z_Calloc(size_t n1, size_t n2, int tag, void **user)
+void *Z_CallocEx(size_t n1, size_t n2, int tag, void **user, const char *file, int line)
 {
-    return ((n1 *= n2) ? memset(Z_Malloc(n1, tag, user), 0, n1) : NULL);
+    return ((n1 *= n2) ? memset(Z_MallocEx(n1, tag, user, file, line), 0, n1) : NULL);
 }
 
 void Z_Free(void *ptr)
@@ -132,6 +175,7 @@ void Z_Free(void *ptr)
     block->prev->next = block->next;
     block->next->prev = block->prev;
 
+    Z_SubtractBytes(&zonestats.tagbytes[block->tag], block->size + headersize);
     free(block);
 }
 
@@ -201,5 +245,276 @@ void Z_ChangeTag(void *ptr, int tag)
         blockbytag[tag]->prev = block;
     }
 
+    zonestats.tagbytes[block->tag] -= block->size + headersize;
+    zonestats.tagbytes[tag] += block->size + headersize;
     block->tag = tag;
 }
+
+//
+// Z_Touch
+// [BH] Move a block tagged PU_CACHE to the end of the list, so that blocks are
+//  purged least recently used first rather than least recently released first.
+//
+void Z_Touch(void *ptr)
+{
+    memblock_t  *block;
+    memblock_t  *head;
+
+    if (!ptr)
+        return;
+
+    block = (memblock_t *)((char *)ptr - headersize);
+
+    if (block->tag != PU_CACHE || block == (head = blockbytag[PU_CACHE])->prev)
+        return;
+
+    // the list is circular, so the first block becomes the last by moving the head on
+    if (block == head)
+    {
+        blockbytag[PU_CACHE] = block->next;
+        return;
+    }
+
+    block->prev->next = block->next;
+    block->next->prev = block->prev;
+
+    head->prev->next = block;
+    block->prev = head->prev;
+    block->next = head;
+    head->prev = block;
+}
+
+static int Z_HashArray(const void *ptr)
+{
+    uint64_t    key = (uint64_t)(uintptr_t)ptr;
+
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+
+    return (int)(key & (maxarrays - 1));
+}
+
+static int Z_FindArray(const void *ptr)
+{
+    if (!numarrays)
+        return -1;
+
+    for (int i = Z_HashArray(ptr); arrays[i].ptr; i = (i + 1) & (maxarrays - 1))
+        if (arrays[i].ptr == ptr)
+            return i;
+
+    return -1;
+}
+
+static void Z_InsertArray(const zonearray_t *array)
+{
+    int i = Z_HashArray(array->ptr);
+
+    while (arrays[i].ptr)
+        i = (i + 1) & (maxarrays - 1);
+
+    arrays[i] = *array;
+    numarrays++;
+}
+
+// shift back any entries that follow so that none are left unreachable
+static void Z_RemoveArray(int i)
+{
+    int j = i;
+
+    while (true)
+    {
+        int k;
+
+        j = (j + 1) & (maxarrays - 1);
+
+        if (!arrays[j].ptr)
+            break;
+
+        k = Z_HashArray(arrays[j].ptr);
+
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            continue;
+
+        arrays[i] = arrays[j];
+        i = j;
+    }
+
+    arrays[i].ptr = NULL;
+    numarrays--;
+}
+
+static void Z_GrowArrays(void)
+{
+    zonearray_t *oldarrays = arrays;
+    const int   oldmaxarrays = maxarrays;
+
+    maxarrays = (maxarrays ? maxarrays * 2 : 256);
+
+    if (!(arrays = calloc(maxarrays, sizeof(*arrays))))
+        I_Error("Z_TrackArray: Failure trying to allocate %i arrays", maxarrays);
+
+    numarrays = 0;
+
+    for (int i = 0; i < oldmaxarrays; i++)
+        if (oldarrays[i].ptr)
+            Z_InsertArray(&oldarrays[i]);
+
+    free(oldarrays);
+}
+
+//
+// Z_TrackArray
+// [BH] Called by I_Realloc() so that arrays that grow outside of the zone are
+//  still accounted for. A NULL newptr means that oldptr has been freed.
+//
+void Z_TrackArray(void *oldptr, void *newptr, size_t size, const char *file, int line)
+{
+    zonearray_t array;
+    int         i;
+
+    if (oldptr && (i = Z_FindArray(oldptr)) >= 0)
+    {
+        Z_SubtractBytes(&zonestats.arraybytes, arrays[i].size);
+        Z_RemoveArray(i);
+    }
+
+    if (!newptr || !size)
+        return;
+
+    // keep the table no more than half full
+    if ((numarrays + 1) * 2 > maxarrays)
+        Z_GrowArrays();
+
+    array.ptr = newptr;
+    array.size = size;
+    array.file = file;
+    array.line = line;
+    Z_InsertArray(&array);
+    Z_AddBytes(&zonestats.arraybytes, size);
+}
+
+//
+// Z_SetBudget
+// [BH] Set a soft limit, in bytes, on the memory used by the zone and by
+//  arrays grown by I_Realloc(). Exceeding it purges blocks tagged PU_CACHE, least
+//  recently used first, until back within it.
+//
+void Z_SetBudget(size_t budget)
+{
+    zonestats.budget = purgethreshold = budget;
+}
+
+//
+// Z_CheckBudget
+// [BH] Called once a frame, when nothing is holding onto PU_CACHE blocks, rather
+//  than from Z_Malloc() itself.
+//
+void Z_CheckBudget(void)
+{
+    size_t  current = zonestats.current;
+
+    if (!zonestats.budget || current <= purgethreshold || !blockbytag[PU_CACHE])
+        return;
+
+    // Z_ChangeTag() and Z_Touch() add blocks to the end of the list, so the least
+    //  recently used are first
+    while (zonestats.current > zonestats.budget && blockbytag[PU_CACHE])
+        Z_Free((char *)blockbytag[PU_CACHE] + headersize);
+
+    zonestats.purges++;
+    zonestats.purged += current - zonestats.current;
+
+    // don't purge again every frame if what's left is still over budget
+    purgethreshold = zonestats.current + zonestats.budget / 8;
+
+    if (purgethreshold < zonestats.budget)
+        purgethreshold = zonestats.budget;
+}
+
+//
+// Z_ResetLevelPeak
+// Called at the start of each map.
+//
+void Z_ResetLevelPeak(void)
+{
+    zonestats.levelpeak = zonestats.current;
+    purgethreshold = zonestats.budget;
+}
+
+static void Z_AddSite(zonesite_t **sites, int *numsites, int *maxsites, const char *file, int line, int tag, size_t bytes)
+{
+    zonesite_t  *site;
+    int         i;
+
+    for (i = 0; i < *numsites; i++)
+    {
+        site = &(*sites)[i];
+
+        if (site->line == line && site->tag == tag && (site->file == file || M_StringCompare(site->file, file)))
+        {
+            site->count++;
+            site->bytes += bytes;
+            return;
+        }
+    }
+
+    if (*numsites == *maxsites)
+    {
+        zonesite_t  *newsites = realloc(*sites, (*maxsites += 64) * sizeof(**sites));
+
+        if (!newsites)
+            I_Error("Z_GetSites: Failure trying to allocate %i sites", *maxsites);
+
+        *sites = newsites;
+    }
+
+    site = &(*sites)[(*numsites)++];
+    site->file = file;
+    site->line = line;
+    site->tag = tag;
+    site->count = 1;
+    site->bytes = bytes;
+}
+
+//
+// Z_GetSites
+// [BH] Return every call site currently holding memory, largest first.
+//
+int Z_GetSites(zonesite_t **sites)
+{
+    static zonesite_t   *list;
+    static int          maxsites;
+    int                 numsites = 0;
+
+    for (int tag = PU_FREE + 1; tag < PU_MAX; tag++)
+    {
+        memblock_t  *block = blockbytag[tag];
+
+        if (block)
+            do
+            {
+                Z_AddSite(&list, &numsites, &maxsites, block->file, block->line, tag, block->size + headersize);
+                block = block->next;
+            } while (block != blockbytag[tag]);
+    }
+
+    for (int i = 0; i < maxarrays; i++)
+        if (arrays[i].ptr)
+            Z_AddSite(&list, &numsites, &maxsites, arrays[i].file, arrays[i].line, -1, arrays[i].size);
+
+    for (int i = 1; i < numsites; i++)
+    {
+        zonesite_t  site = list[i];
+        int         j = i;
+
+        for (; j > 0 && list[j - 1].bytes < site.bytes; j--)
+            list[j] = list[j - 1];
+
+        list[j] = site;
+    }
+
+    *sites = list;
+    return numsites;
+}
@@ -60,10 +60,44 @@ enum
 
 #define PU_PURGELEVEL    PU_CACHE    // First purgeable tag's level
 
-void *Z_Malloc(size_t size, int tag, void **user);
-void *Z_Calloc(size_t n1, size_t n2, int tag, void **user);
+// [BH] A call site that is currently holding memory, for the memreport CCMD.
+typedef struct
+{
+    const char  *file;
+    int         line;
+    int         tag;        // -1 for arrays grown by I_Realloc()
+    int         count;
+    size_t      bytes;
+} zonesite_t;
+
+typedef struct
+{
+    size_t      tagbytes[PU_MAX];
+    size_t      arraybytes; // bytes held by arrays grown by I_Realloc()
+    size_t      current;
+    size_t      peak;
+    size_t      levelpeak;
+    size_t      budget;     // soft budget, or 0 if there isn't one
+    int         purges;     // number of times PU_CACHE was purged to stay within budget
+    size_t      purged;     // bytes purged from PU_CACHE to stay within budget
+} zonestats_t;
+
+extern zonestats_t  zonestats;
+
+void *Z_MallocEx(size_t size, int tag, void **user, const char *file, int line);
+void *Z_CallocEx(size_t n1, size_t n2, int tag, void **user, const char *file, int line);
 void Z_Free(void *ptr);
 void Z_FreeTags(int lowtag, int hightag);
 void Z_ChangeTag(void *ptr, int tag);
+void Z_Touch(void *ptr);
+
+void Z_TrackArray(void *oldptr, void *newptr, size_t size, const char *file, int line);
+void Z_SetBudget(size_t budget);
+void Z_CheckBudget(void);
+void Z_ResetLevelPeak(void);
+int Z_GetSites(zonesite_t **sites);
+
+#define Z_Malloc(size, tag, user)       Z_MallocEx(size, tag, user, __FILE__, __LINE__)
+#define Z_Calloc(n1, n2, tag, user)     Z_CallocEx(n1, n2, tag, user, __FILE__, __LINE__)
 
 #endif